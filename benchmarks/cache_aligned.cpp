@@ -0,0 +1,106 @@
+#include "cache_aligned.hpp"
+#include "generic_vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t SLOTS = 64U;
+
+// Per-core state, 16 bytes, so four neighbouring slots share a cache line unless they are padded
+struct State
+{
+    std::atomic<std::uint64_t> events;
+    std::atomic<std::uint64_t> bytes;
+};
+
+using Packed = containers::StackVector<State, SLOTS>;
+using Padded = containers::CacheAlignedStackVector<State, SLOTS>;
+using PackedHeap = containers::HeapVector<State, SLOTS>;
+using PaddedHeap = containers::CacheAlignedHeapVector<State, SLOTS>;
+
+// Every thread increments the slot with its own index; relaxed load and store keep the increments thread-local in
+// the program but force a write to the cache line on every iteration
+template <typename Vector> double nsPerIncrement(const std::size_t threads, const std::uint64_t increments)
+{
+    const auto slots = std::make_unique<Vector>();
+    for (std::size_t i = 0U; i < SLOTS; ++i)
+    {
+        slots->emplace_back();
+    }
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0U; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            State &state = (*slots)[t];
+            while (!start.load(std::memory_order_acquire))
+            {
+            }
+
+            for (std::uint64_t i = 0U; i < increments; ++i)
+            {
+                state.events.store(state.events.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+                state.bytes.store(state.bytes.load(std::memory_order_relaxed) + 64U, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    const auto t1 = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    for (std::size_t t = 0U; t < threads; ++t)
+    {
+        if ((*slots)[t].events.load() != increments)
+        {
+            std::cerr << "Lost increments in slot " << t << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(increments * threads);
+}
+
+// Powers of two up to the number of cores, always finishing with the number of cores itself
+inline std::size_t nextThreadCount(const std::size_t count, const std::size_t cores) noexcept
+{
+    return ((count < cores) && ((count * 2U) > cores)) ? cores : (count * 2U);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t increments = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10'000'000U;
+    const std::size_t cores = std::min<std::size_t>(SLOTS, std::max(1U, std::thread::hardware_concurrency()));
+
+    std::cout << "Element size: packed " << sizeof(State) << " bytes, padded "
+              << sizeof(containers::CacheAligned<State>) << " bytes" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "threads packed[ns/op] padded[ns/op] packed_heap[ns/op] padded_heap[ns/op]" << std::endl;
+
+    for (std::size_t threads = 1U; threads <= cores; threads = nextThreadCount(threads, cores))
+    {
+        std::cout << threads << " " << nsPerIncrement<Packed>(threads, increments) << " "
+                  << nsPerIncrement<Padded>(threads, increments) << " "
+                  << nsPerIncrement<PackedHeap>(threads, increments) << " "
+                  << nsPerIncrement<PaddedHeap>(threads, increments) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include "concurrent_pool.hpp"
+#include "mpmc_circular_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Message
+{
+    std::uint64_t id;
+    std::uint64_t payload[7];
+};
+
+constexpr std::size_t POOL_SIZE = 1U << 20U;
+constexpr std::size_t LIVE_OBJECTS = 64U;
+constexpr std::size_t QUEUE_SIZE = 4096U;
+
+using Pool = containers::HeapConcurrentPool<Message, POOL_SIZE>;
+using Queue = containers::MpmcCircularBuffer<Message *, QUEUE_SIZE>;
+
+// Each backend provides a per-thread allocator object with allocate() and deallocate()
+struct PoolBackend
+{
+    class Local
+    {
+      public:
+        explicit Local(Pool &pool) : cache_{pool}
+        {
+        }
+
+        inline Message *allocate()
+        {
+            return cache_.allocate();
+        }
+
+        inline void deallocate(Message *p) noexcept
+        {
+            cache_.deallocate(p);
+        }
+
+      private:
+        Pool::ThreadCache cache_;
+    };
+};
+
+struct MallocBackend
+{
+    struct Local
+    {
+        explicit Local(Pool &)
+        {
+        }
+
+        inline Message *allocate()
+        {
+            return static_cast<Message *>(std::malloc(sizeof(Message)));
+        }
+
+        inline void deallocate(Message *p) noexcept
+        {
+            std::free(p);
+        }
+    };
+};
+
+struct NewBackend
+{
+    struct Local
+    {
+        explicit Local(Pool &)
+        {
+        }
+
+        inline Message *allocate()
+        {
+            return new Message;
+        }
+
+        inline void deallocate(Message *p) noexcept
+        {
+            delete p;
+        }
+    };
+};
+
+template <typename Function> double nsPerOp(const std::size_t threads, const std::uint64_t operations, Function &&body)
+{
+    std::atomic<bool> start{false};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0U; t < threads; ++t)
+    {
+        workers.emplace_back([&]() {
+            while (!start.load(std::memory_order_acquire))
+            {
+            }
+            body();
+        });
+    }
+
+    const auto t1 = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(operations * threads);
+}
+
+// Every thread keeps LIVE_OBJECTS messages alive and replaces them round-robin, all frees are thread-local
+template <typename Backend> double runLocal(Pool &pool, const std::size_t threads, const std::uint64_t operations)
+{
+    return nsPerOp(threads, operations, [&]() {
+        typename Backend::Local local{pool};
+        Message *live[LIVE_OBJECTS];
+        for (auto &message : live)
+        {
+            message = local.allocate();
+        }
+
+        for (std::uint64_t i = 0U; i < operations; ++i)
+        {
+            Message *&slot = live[i % LIVE_OBJECTS];
+            local.deallocate(slot);
+            slot = local.allocate();
+            slot->id = i;
+        }
+
+        for (auto &message : live)
+        {
+            local.deallocate(message);
+        }
+    });
+}
+
+// Every thread hands its messages to a shared queue and frees whatever it pops, which is usually a message allocated
+// by another thread
+template <typename Backend> double runCrossThread(Pool &pool, const std::size_t threads, const std::uint64_t operations)
+{
+    const auto queue = std::make_unique<Queue>();
+    const double result = nsPerOp(threads, operations, [&]() {
+        typename Backend::Local local{pool};
+        for (std::uint64_t i = 0U; i < operations; ++i)
+        {
+            Message *message = local.allocate();
+            message->id = i;
+            if (!queue->try_push(message))
+            {
+                local.deallocate(message);
+            }
+
+            if (queue->try_pop(message))
+            {
+                local.deallocate(message);
+            }
+        }
+    });
+
+    typename Backend::Local local{pool};
+    Message *message;
+    while (queue->try_pop(message))
+    {
+        local.deallocate(message);
+    }
+
+    return result;
+}
+
+// Powers of two up to the number of cores, always finishing with the number of cores itself
+inline std::size_t nextThreadCount(const std::size_t count, const std::size_t cores) noexcept
+{
+    return ((count < cores) && ((count * 2U) > cores)) ? cores : (count * 2U);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t operations = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1'000'000U;
+    const std::size_t cores = std::max<std::size_t>(1U, std::thread::hardware_concurrency());
+
+    const auto pool = std::make_unique<Pool>();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "threads workload pool[ns/op] malloc[ns/op] new[ns/op]" << std::endl;
+
+    for (std::size_t threads = 1U; threads <= cores; threads = nextThreadCount(threads, cores))
+    {
+        std::cout << threads << " local " << runLocal<PoolBackend>(*pool, threads, operations) << " "
+                  << runLocal<MallocBackend>(*pool, threads, operations) << " "
+                  << runLocal<NewBackend>(*pool, threads, operations) << std::endl;
+
+        std::cout << threads << " cross-thread " << runCrossThread<PoolBackend>(*pool, threads, operations) << " "
+                  << runCrossThread<MallocBackend>(*pool, threads, operations) << " "
+                  << runCrossThread<NewBackend>(*pool, threads, operations) << std::endl;
+    }
+
+    return 0;
+}
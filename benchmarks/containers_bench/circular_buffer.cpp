@@ -0,0 +1,206 @@
+#include "circular_buffer.hpp"
+#include "harness.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+namespace
+{
+template <std::size_t Bytes> using Payload = bench::Payload<Bytes>;
+
+// FIFO adapters so the same benchmark bodies drive both containers
+template <typename Buffer> struct RingQueue
+{
+    template <typename T> inline void push(T &&value)
+    {
+        buffer.push(std::forward<T>(value));
+    }
+
+    template <typename T> inline void pop(T &out)
+    {
+        buffer.try_pop(out);
+    }
+
+    inline const Buffer &elements() const noexcept
+    {
+        return buffer;
+    }
+
+    Buffer buffer;
+};
+
+template <typename T> struct DequeQueue
+{
+    inline void push(const T &value)
+    {
+        deque.push_back(value);
+    }
+
+    inline void pop(T &out)
+    {
+        out = deque.front();
+        deque.pop_front();
+    }
+
+    inline const std::deque<T> &elements() const noexcept
+    {
+        return deque;
+    }
+
+    std::deque<T> deque;
+};
+
+// Fills the queue to capacity and drains it again
+template <typename Queue, std::size_t Bytes, std::size_t Capacity> void fillDrain(bench::State &state)
+{
+    const auto queue = std::make_unique<Queue>();
+    Payload<Bytes> out;
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            queue->push(Payload<Bytes>{i});
+        }
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            queue->pop(out);
+        }
+        bench::doNotOptimize(out);
+    }
+
+    // One item is one push plus one pop
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Keeps the queue half full and alternates push and pop, the usual producer/consumer steady state
+template <typename Queue, std::size_t Bytes, std::size_t Capacity> void steadyState(bench::State &state)
+{
+    const auto queue = std::make_unique<Queue>();
+    for (std::size_t i = 0U; i < (Capacity / 2U); ++i)
+    {
+        queue->push(Payload<Bytes>{i});
+    }
+    Payload<Bytes> out;
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            queue->push(Payload<Bytes>{i});
+            queue->pop(out);
+        }
+        bench::doNotOptimize(out);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Fills the queue to capacity with a wrapped-around ring and scans it in place
+template <typename Queue, std::size_t Bytes, std::size_t Capacity> std::unique_ptr<Queue> makeWrapped()
+{
+    auto queue = std::make_unique<Queue>();
+    Payload<Bytes> out;
+    for (std::size_t i = 0U; i < (Capacity / 2U); ++i)
+    {
+        queue->push(Payload<Bytes>{i});
+        queue->pop(out);
+    }
+    for (std::size_t i = 0U; i < Capacity; ++i)
+    {
+        queue->push(Payload<Bytes>{i});
+    }
+    return queue;
+}
+
+template <typename Queue, std::size_t Bytes, std::size_t Capacity> void iterate(bench::State &state)
+{
+    const auto queue = makeWrapped<Queue, Bytes, Capacity>();
+
+    while (state.keepRunning())
+    {
+        std::uint64_t sum = 0U;
+        for (const Payload<Bytes> &element : queue->elements())
+        {
+            sum += element.words[0];
+        }
+        bench::doNotOptimize(sum);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Same scan over the two contiguous chunks of a ring
+template <typename Queue, std::size_t Bytes, std::size_t Capacity> void iterateSegments(bench::State &state)
+{
+    const auto queue = makeWrapped<Queue, Bytes, Capacity>();
+
+    while (state.keepRunning())
+    {
+        const auto segments = queue->elements().segments();
+        std::uint64_t sum = 0U;
+        for (const Payload<Bytes> &element : segments.first)
+        {
+            sum += element.words[0];
+        }
+        for (const Payload<Bytes> &element : segments.second)
+        {
+            sum += element.words[0];
+        }
+        bench::doNotOptimize(sum);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+template <typename Family> struct QueueOperations
+{
+    template <std::size_t Bytes, std::size_t Capacity> static void run()
+    {
+        using Queue = typename Family::template Queue<Bytes, Capacity>;
+        bench::add("fill_drain", Family::NAME, Bytes, Capacity, fillDrain<Queue, Bytes, Capacity>);
+        bench::add("steady_state", Family::NAME, Bytes, Capacity, steadyState<Queue, Bytes, Capacity>);
+        bench::add("iterate", Family::NAME, Bytes, Capacity, iterate<Queue, Bytes, Capacity>);
+        if constexpr (Family::SEGMENTED)
+        {
+            bench::add("iterate_segments", Family::NAME, Bytes, Capacity, iterateSegments<Queue, Bytes, Capacity>);
+        }
+    }
+};
+
+struct StackCircularBufferFamily
+{
+    static constexpr const char *NAME = "CircularBuffer<Stack>";
+    static constexpr bool SEGMENTED = true;
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Queue = RingQueue<containers::StackCircularBuffer<Payload<Bytes>, Capacity>>;
+};
+
+struct HeapCircularBufferFamily
+{
+    static constexpr const char *NAME = "CircularBuffer<Heap>";
+    static constexpr bool SEGMENTED = true;
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Queue = RingQueue<containers::HeapCircularBuffer<Payload<Bytes>, Capacity>>;
+};
+
+struct StdDequeFamily
+{
+    static constexpr const char *NAME = "std::deque";
+    static constexpr bool SEGMENTED = false;
+
+    template <std::size_t Bytes, std::size_t Capacity> using Queue = DequeQueue<Payload<Bytes>>;
+};
+
+const bool registered = (bench::registerAllSizes<QueueOperations<StackCircularBufferFamily>>(),
+                         bench::registerAllSizes<QueueOperations<HeapCircularBufferFamily>>(),
+                         bench::registerAllSizes<QueueOperations<StdDequeFamily>>(), true);
+} // namespace
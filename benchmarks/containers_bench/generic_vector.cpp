@@ -0,0 +1,35 @@
+#include "generic_vector.hpp"
+#include "vector_benchmarks.hpp"
+
+#include <vector>
+
+namespace
+{
+struct GenericStackVectorFamily
+{
+    static constexpr const char *NAME = "GenericVector<Stack>";
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Container = containers::GenericVector<bench::Payload<Bytes>, Capacity, containers::StackAllocationPolicy>;
+};
+
+struct GenericHeapVectorFamily
+{
+    static constexpr const char *NAME = "GenericVector<Heap>";
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Container = containers::GenericVector<bench::Payload<Bytes>, Capacity, containers::HeapAllocationPolicy>;
+};
+
+// Reserved up front, so it is compared without reallocations
+struct StdVectorFamily
+{
+    static constexpr const char *NAME = "std::vector";
+
+    template <std::size_t Bytes, std::size_t Capacity> using Container = std::vector<bench::Payload<Bytes>>;
+};
+
+const bool registered = (bench::registerAllSizes<bench::VectorOperations<GenericStackVectorFamily>>(),
+                         bench::registerAllSizes<bench::VectorOperations<GenericHeapVectorFamily>>(),
+                         bench::registerAllSizes<bench::VectorOperations<StdVectorFamily>>(), true);
+} // namespace
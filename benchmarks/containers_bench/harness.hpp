@@ -0,0 +1,331 @@
+#ifndef CONTAINERS_BENCH_HARNESS_HPP
+#define CONTAINERS_BENCH_HARNESS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Minimal benchmark harness in the style of Google Benchmark: benchmarks register a function taking a State, the
+// runner calibrates the iteration count, runs warmup and repetitions and reports statistics.
+namespace bench
+{
+// Keeps the compiler from discarding a value or assuming memory is unchanged
+template <typename T> inline void doNotOptimize(T &&value) noexcept
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobberMemory() noexcept
+{
+    asm volatile("" : : : "memory");
+}
+
+// Element types of different sizes, so cache footprint and copy cost can be compared
+template <std::size_t Bytes> struct Payload
+{
+    static_assert((Bytes % sizeof(std::uint64_t)) == 0U, "Payload size must be a multiple of 8 bytes.");
+
+    Payload() noexcept : words{}
+    {
+    }
+
+    explicit Payload(const std::uint64_t value) noexcept : words{}
+    {
+        words[0] = value;
+    }
+
+    std::uint64_t words[Bytes / sizeof(std::uint64_t)];
+};
+
+// Hardware counters for the timed region, read as one group so the values are consistent. Unavailable counters,
+// e.g. without permission or inside a VM, leave the group disabled and the runner reports no counters.
+class PerfCounters
+{
+  public:
+    static constexpr std::size_t COUNT = 4U;
+    static constexpr std::array<const char *, COUNT> NAMES = {"cycles", "instructions", "cache_misses",
+                                                              "branch_misses"};
+
+    using Values = std::array<std::uint64_t, COUNT>;
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    explicit PerfCounters(const bool enable) noexcept : fds_{-1, -1, -1, -1}
+    {
+#if defined(__linux__) && defined(SYS_perf_event_open)
+        if (!enable)
+        {
+            return;
+        }
+
+        constexpr std::array<std::uint64_t, COUNT> CONFIGS = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                              PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (std::size_t i = 0U; i < COUNT; ++i)
+        {
+            perf_event_attr attributes{};
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(attributes);
+            attributes.config = CONFIGS[i];
+            attributes.disabled = (i == 0U) ? 1U : 0U;
+            attributes.exclude_kernel = 1U;
+            attributes.exclude_hv = 1U;
+            attributes.read_format = PERF_FORMAT_GROUP;
+
+            fds_[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, fds_[0], 0));
+            if (fds_[i] < 0)
+            {
+                close();
+                return;
+            }
+        }
+#else
+        static_cast<void>(enable);
+#endif
+    }
+
+    ~PerfCounters()
+    {
+        close();
+    }
+
+    inline bool available() const noexcept
+    {
+        return (fds_[0] >= 0);
+    }
+
+    inline void start() noexcept
+    {
+#if defined(__linux__)
+        if (available())
+        {
+            ::ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ::ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    inline void stop() noexcept
+    {
+#if defined(__linux__)
+        if (available())
+        {
+            ::ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    // Counts since the last start(), all zero if the counters are unavailable
+    Values read() const noexcept
+    {
+        Values values{};
+#if defined(__linux__)
+        if (available())
+        {
+            // Layout with PERF_FORMAT_GROUP: number of events followed by one value per event
+            std::array<std::uint64_t, COUNT + 1U> buffer{};
+            if (::read(fds_[0], buffer.data(), sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer)))
+            {
+                for (std::size_t i = 0U; i < COUNT; ++i)
+                {
+                    values[i] = buffer[i + 1U];
+                }
+            }
+        }
+#endif
+        return values;
+    }
+
+  private:
+    void close() noexcept
+    {
+#if defined(__linux__)
+        for (int &fd : fds_)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+#endif
+    }
+
+    std::array<int, COUNT> fds_;
+};
+
+// Passed to a benchmark function, which runs its timed body while keepRunning() returns true:
+//
+//     void pushBack(bench::State &state)
+//     {
+//         Container container;               // setup, not timed
+//         while (state.keepRunning())
+//         {
+//             ...                            // timed
+//         }
+//         state.setItemsPerIteration(N);
+//     }
+class State
+{
+  public:
+    State(const std::uint64_t iterations, PerfCounters &counters) noexcept
+        : iterations_{iterations}, remaining_{iterations}, items_per_iteration_{1U}, bytes_per_item_{0U},
+          elapsed_{0}, counters_{counters}, counts_{}, begun_{false}, timing_{false}
+    {
+    }
+
+    // The clock starts on the first call and stops once all iterations have run
+    inline bool keepRunning() noexcept
+    {
+        if (remaining_ > 0U) [[likely]]
+        {
+            if (!begun_) [[unlikely]]
+            {
+                begun_ = true;
+                resumeTiming();
+            }
+            --remaining_;
+            return true;
+        }
+
+        pauseTiming();
+        return false;
+    }
+
+    // Excludes work inside the loop from the measurement, e.g. refilling a container
+    inline void pauseTiming() noexcept
+    {
+        if (timing_)
+        {
+            counters_.stop();
+            const auto now = std::chrono::steady_clock::now();
+            elapsed_ += (now - start_);
+            const PerfCounters::Values counts = counters_.read();
+            for (std::size_t i = 0U; i < PerfCounters::COUNT; ++i)
+            {
+                counts_[i] += counts[i];
+            }
+            timing_ = false;
+        }
+    }
+
+    inline void resumeTiming() noexcept
+    {
+        timing_ = true;
+        counters_.start();
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    // Operations performed by one iteration, ns/op and throughput are reported per item
+    inline void setItemsPerIteration(const std::uint64_t items) noexcept
+    {
+        items_per_iteration_ = items;
+    }
+
+    // Bytes moved per item for the bytes/s throughput, usually the element size
+    inline void setBytesPerItem(const std::uint64_t bytes) noexcept
+    {
+        bytes_per_item_ = bytes;
+    }
+
+    inline std::uint64_t iterations() const noexcept
+    {
+        return iterations_;
+    }
+
+    inline std::uint64_t items() const noexcept
+    {
+        return iterations_ * items_per_iteration_;
+    }
+
+    inline std::uint64_t bytesPerItem() const noexcept
+    {
+        return bytes_per_item_;
+    }
+
+    inline double elapsedNs() const noexcept
+    {
+        return std::chrono::duration<double, std::nano>(elapsed_).count();
+    }
+
+    inline const PerfCounters::Values &counts() const noexcept
+    {
+        return counts_;
+    }
+
+  private:
+    std::uint64_t iterations_;
+    std::uint64_t remaining_;
+    std::uint64_t items_per_iteration_;
+    std::uint64_t bytes_per_item_;
+    std::chrono::steady_clock::duration elapsed_;
+    std::chrono::steady_clock::time_point start_;
+    PerfCounters &counters_;
+    PerfCounters::Values counts_;
+    bool begun_;
+    bool timing_;
+};
+
+struct Benchmark
+{
+    std::string operation;      // e.g. "push_back"
+    std::string container;      // e.g. "StackVector"
+    std::size_t element_size;   // bytes
+    std::size_t capacity;       // elements
+    std::function<void(State &)> function;
+
+    std::string name() const
+    {
+        return operation + "/" + container + "/" + std::to_string(element_size) + "B/" + std::to_string(capacity);
+    }
+};
+
+inline std::vector<Benchmark> &registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+inline void add(std::string operation, std::string container, const std::size_t element_size,
+                const std::size_t capacity, std::function<void(State &)> function)
+{
+    registry().push_back(
+        Benchmark{std::move(operation), std::move(container), element_size, capacity, std::move(function)});
+}
+
+// Calls F::template run<Bytes, Capacity>() for every combination, used by the benchmark files to register one
+// benchmark family across element sizes and capacities
+template <typename F, std::size_t... Bytes> struct ForSizes
+{
+    template <std::size_t... Capacities> static void capacities()
+    {
+        (..., each<Bytes, Capacities...>());
+    }
+
+  private:
+    template <std::size_t B, std::size_t... Capacities> static void each()
+    {
+        (..., F::template run<B, Capacities>());
+    }
+};
+
+// Element sizes (bytes) and capacities (elements, powers of two) every container is measured with
+template <typename F> inline void registerAllSizes()
+{
+    ForSizes<F, 8U, 64U, 256U>::template capacities<64U, 1024U, 16384U>();
+}
+} // namespace bench
+
+#endif // CONTAINERS_BENCH_HARNESS_HPP
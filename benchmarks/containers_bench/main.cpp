@@ -0,0 +1,341 @@
+#include "harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Options
+{
+    std::string filter;
+    std::string json_path;
+    double min_time_s{0.05};
+    int repetitions{3};
+    bool perf{false};
+    bool list{false};
+};
+
+struct Result
+{
+    const bench::Benchmark *benchmark;
+    std::uint64_t iterations;
+    std::uint64_t bytes_per_item;
+    double mean_ns;
+    double median_ns;
+    double stddev_ns;
+    double min_ns;
+    double max_ns;
+    bool has_counters;
+    std::array<double, bench::PerfCounters::COUNT> counters_per_item;
+};
+
+void printUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --filter=<text>       Run only benchmarks whose name contains text\n"
+              << "  --min-time=<seconds>  Minimum duration of one repetition (default 0.05)\n"
+              << "  --repetitions=<n>     Measured repetitions per benchmark (default 3)\n"
+              << "  --perf                Collect hardware counters via perf_event_open\n"
+              << "  --json=<path>         Write the results as JSON, '-' for stdout\n"
+              << "  --list                List the benchmark names and exit\n";
+}
+
+bool parseOptions(const int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument{argv[i]};
+        const auto value = [&argument](const std::string_view prefix) {
+            return std::string{argument.substr(prefix.size())};
+        };
+
+        if (argument.starts_with("--filter="))
+        {
+            options.filter = value("--filter=");
+        }
+        else if (argument.starts_with("--json="))
+        {
+            options.json_path = value("--json=");
+        }
+        else if (argument.starts_with("--min-time="))
+        {
+            options.min_time_s = std::strtod(value("--min-time=").c_str(), nullptr);
+        }
+        else if (argument.starts_with("--repetitions="))
+        {
+            options.repetitions = std::max(1, std::atoi(value("--repetitions=").c_str()));
+        }
+        else if (argument == "--perf")
+        {
+            options.perf = true;
+        }
+        else if (argument == "--list")
+        {
+            options.list = true;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Grows the iteration count until one run takes at least min_time. The calibration runs double as warmup: caches,
+// branch predictors and the allocator are in steady state before the measured repetitions start.
+std::uint64_t calibrate(const bench::Benchmark &benchmark, bench::PerfCounters &counters, const double min_time_s)
+{
+    const double min_time_ns = min_time_s * 1e9;
+    std::uint64_t iterations = 1U;
+    while (true)
+    {
+        bench::State state{iterations, counters};
+        benchmark.function(state);
+        const double elapsed = state.elapsedNs();
+        if ((elapsed >= min_time_ns) || (iterations >= (1ULL << 40U)))
+        {
+            return iterations;
+        }
+
+        // Aim slightly above min_time, but grow by at most 10x per step in case the first runs were noisy
+        const double factor = (elapsed > 0.0) ? std::clamp(1.4 * min_time_ns / elapsed, 2.0, 10.0) : 10.0;
+        iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * factor);
+    }
+}
+
+Result run(const bench::Benchmark &benchmark, bench::PerfCounters &counters, const Options &options)
+{
+    const std::uint64_t iterations = calibrate(benchmark, counters, options.min_time_s);
+
+    std::vector<double> samples;
+    std::uint64_t total_items = 0U;
+    std::uint64_t bytes_per_item = 0U;
+    std::array<std::uint64_t, bench::PerfCounters::COUNT> total_counts{};
+    for (int repetition = 0; repetition < options.repetitions; ++repetition)
+    {
+        bench::State state{iterations, counters};
+        benchmark.function(state);
+        samples.push_back(state.elapsedNs() / static_cast<double>(state.items()));
+        total_items += state.items();
+        bytes_per_item = state.bytesPerItem();
+        for (std::size_t i = 0U; i < bench::PerfCounters::COUNT; ++i)
+        {
+            total_counts[i] += state.counts()[i];
+        }
+    }
+
+    Result result{};
+    result.benchmark = &benchmark;
+    result.iterations = iterations;
+    result.bytes_per_item = bytes_per_item;
+
+    const double count = static_cast<double>(samples.size());
+    result.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / count;
+    double variance = 0.0;
+    for (const double sample : samples)
+    {
+        variance += (sample - result.mean_ns) * (sample - result.mean_ns);
+    }
+    result.stddev_ns = (samples.size() > 1U) ? std::sqrt(variance / (count - 1.0)) : 0.0;
+
+    std::sort(samples.begin(), samples.end());
+    const std::size_t middle = samples.size() / 2U;
+    result.median_ns = ((samples.size() % 2U) == 1U) ? samples[middle] : 0.5 * (samples[middle - 1U] + samples[middle]);
+    result.min_ns = samples.front();
+    result.max_ns = samples.back();
+
+    result.has_counters = counters.available();
+    for (std::size_t i = 0U; i < bench::PerfCounters::COUNT; ++i)
+    {
+        result.counters_per_item[i] = static_cast<double>(total_counts[i]) / static_cast<double>(total_items);
+    }
+
+    return result;
+}
+
+void printHeader(const bool counters)
+{
+    std::cout << std::left << std::setw(56) << "benchmark" << std::right << std::setw(12) << "ns/op" << std::setw(9)
+              << "+-%" << std::setw(14) << "Mitems/s" << std::setw(12) << "MB/s";
+    if (counters)
+    {
+        std::cout << std::setw(12) << "cycles/op" << std::setw(8) << "IPC" << std::setw(14) << "cache-miss/op";
+    }
+    std::cout << std::endl;
+}
+
+void printResult(const Result &result)
+{
+    const double items_per_second = 1e9 / result.median_ns;
+    const double relative_stddev = (result.mean_ns > 0.0) ? (100.0 * result.stddev_ns / result.mean_ns) : 0.0;
+
+    std::cout << std::left << std::setw(56) << result.benchmark->name() << std::right << std::fixed
+              << std::setprecision(3) << std::setw(12) << result.median_ns << std::setprecision(1) << std::setw(9)
+              << relative_stddev << std::setprecision(2) << std::setw(14) << (items_per_second / 1e6)
+              << std::setprecision(1) << std::setw(12)
+              << (items_per_second * static_cast<double>(result.bytes_per_item) / 1e6);
+    if (result.has_counters)
+    {
+        const double cycles = result.counters_per_item[0];
+        const double instructions = result.counters_per_item[1];
+        std::cout << std::setprecision(2) << std::setw(12) << cycles << std::setw(8)
+                  << ((cycles > 0.0) ? (instructions / cycles) : 0.0) << std::setprecision(4) << std::setw(14)
+                  << result.counters_per_item[2];
+    }
+    std::cout << std::endl;
+}
+
+std::string jsonEscape(const std::string &text)
+{
+    std::string escaped;
+    for (const char c : text)
+    {
+        if ((c == '"') || (c == '\\'))
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+// One object per benchmark with the parameters as separate fields, so regressions can be tracked per container,
+// operation, element size and capacity across releases
+void writeJson(std::ostream &out, const std::vector<Result> &results, const Options &options, const bool counters)
+{
+    const std::time_t now = std::time(nullptr);
+    char date[32] = {};
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    out << "{\n  \"context\": {\n";
+    out << "    \"date\": \"" << date << "\",\n";
+    out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#if defined(__VERSION__)
+    out << "    \"compiler\": \"" << jsonEscape(__VERSION__) << "\",\n";
+#endif
+#if defined(NDEBUG)
+    out << "    \"build_type\": \"release\",\n";
+#else
+    out << "    \"build_type\": \"debug\",\n";
+#endif
+    out << "    \"min_time_s\": " << options.min_time_s << ",\n";
+    out << "    \"repetitions\": " << options.repetitions << ",\n";
+    out << "    \"perf_counters\": " << (counters ? "true" : "false") << "\n  },\n";
+
+    out << "  \"benchmarks\": [";
+    for (std::size_t r = 0U; r < results.size(); ++r)
+    {
+        const Result &result = results[r];
+        const bench::Benchmark &benchmark = *result.benchmark;
+        const double items_per_second = 1e9 / result.median_ns;
+
+        out << ((r == 0U) ? "\n" : ",\n") << "    {\n";
+        out << "      \"name\": \"" << jsonEscape(benchmark.name()) << "\",\n";
+        out << "      \"operation\": \"" << jsonEscape(benchmark.operation) << "\",\n";
+        out << "      \"container\": \"" << jsonEscape(benchmark.container) << "\",\n";
+        out << "      \"element_size\": " << benchmark.element_size << ",\n";
+        out << "      \"capacity\": " << benchmark.capacity << ",\n";
+        out << "      \"iterations\": " << result.iterations << ",\n";
+        out << std::setprecision(6) << std::defaultfloat;
+        out << "      \"ns_per_op\": {\"median\": " << result.median_ns << ", \"mean\": " << result.mean_ns
+            << ", \"stddev\": " << result.stddev_ns << ", \"min\": " << result.min_ns << ", \"max\": " << result.max_ns
+            << "},\n";
+        out << "      \"items_per_second\": " << items_per_second << ",\n";
+        out << "      \"bytes_per_second\": " << (items_per_second * static_cast<double>(result.bytes_per_item));
+        if (result.has_counters)
+        {
+            out << ",\n      \"counters_per_op\": {";
+            for (std::size_t i = 0U; i < bench::PerfCounters::COUNT; ++i)
+            {
+                out << ((i == 0U) ? "" : ", ") << "\"" << bench::PerfCounters::NAMES[i]
+                    << "\": " << result.counters_per_item[i];
+            }
+            out << "}";
+        }
+        out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return (std::string_view{argv[argc - 1]} == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::vector<const bench::Benchmark *> selected;
+    for (const bench::Benchmark &benchmark : bench::registry())
+    {
+        if (benchmark.name().find(options.filter) != std::string::npos)
+        {
+            selected.push_back(&benchmark);
+        }
+    }
+
+    if (options.list)
+    {
+        for (const bench::Benchmark *benchmark : selected)
+        {
+            std::cout << benchmark->name() << std::endl;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    bench::PerfCounters counters{options.perf};
+    if (options.perf && !counters.available())
+    {
+        std::cerr << "Hardware counters are not available (check perf_event_paranoid), continuing without them"
+                  << std::endl;
+    }
+
+#if !defined(NDEBUG)
+    std::cerr << "Warning: benchmarks built without NDEBUG, configure with -DCMAKE_BUILD_TYPE=Release" << std::endl;
+#endif
+
+    // With JSON on stdout the table goes to stderr, so the output stays parseable
+    const bool json_to_stdout = (options.json_path == "-");
+    std::streambuf *const table = json_to_stdout ? std::cout.rdbuf(std::cerr.rdbuf()) : nullptr;
+
+    printHeader(counters.available());
+    std::vector<Result> results;
+    for (const bench::Benchmark *benchmark : selected)
+    {
+        results.push_back(run(*benchmark, counters, options));
+        printResult(results.back());
+    }
+
+    if (json_to_stdout)
+    {
+        std::cout.rdbuf(table);
+        writeJson(std::cout, results, options, counters.available());
+    }
+    else if (!options.json_path.empty())
+    {
+        std::ofstream file{options.json_path};
+        if (!file)
+        {
+            std::cerr << "Cannot write " << options.json_path << std::endl;
+            return EXIT_FAILURE;
+        }
+        writeJson(file, results, options, counters.available());
+    }
+
+    return EXIT_SUCCESS;
+}
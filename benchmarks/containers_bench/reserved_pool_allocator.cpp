@@ -0,0 +1,94 @@
+#include "harness.hpp"
+#include "reserved_pool_allocator.hpp"
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace
+{
+template <std::size_t Bytes> using Payload = bench::Payload<Bytes>;
+
+// Constructs a vector with the allocator, reserves capacity and fills it, so each iteration pays for setting up the
+// pool (or the malloc call) once
+template <typename Vector, std::size_t Bytes, std::size_t Capacity> void vectorFill(bench::State &state)
+{
+    while (state.keepRunning())
+    {
+        const auto vector = std::make_unique<Vector>();
+        vector->reserve(Capacity);
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            vector->push_back(Payload<Bytes>{i});
+        }
+        bench::doNotOptimize(vector->data());
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Inserts half the capacity into a long-lived list and clears it, one node allocation and free per item
+template <typename List, std::size_t Bytes, std::size_t Capacity> void listChurn(bench::State &state)
+{
+    const auto list = std::make_unique<List>();
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < (Capacity / 2U); ++i)
+        {
+            list->push_back(Payload<Bytes>{i});
+        }
+        bench::doNotOptimize(list->back());
+        list->clear();
+    }
+
+    state.setItemsPerIteration(Capacity / 2U);
+    state.setBytesPerItem(Bytes);
+}
+
+template <typename Family> struct AllocatorOperations
+{
+    template <std::size_t Bytes, std::size_t Capacity> static void run()
+    {
+        using Vector = std::vector<Payload<Bytes>, typename Family::template VectorAllocator<Bytes, Capacity>>;
+        using List = std::list<Payload<Bytes>, typename Family::template ListAllocator<Bytes, Capacity>>;
+        bench::add("vector_fill", Family::NAME, Bytes, Capacity, vectorFill<Vector, Bytes, Capacity>);
+        bench::add("list_churn", Family::NAME, Bytes, Capacity, listChurn<List, Bytes, Capacity>);
+    }
+};
+
+// Monotonic pools serve the vector, the list needs recycling because it frees every node
+template <template <typename, std::size_t> class StoragePolicy> struct PoolFamily
+{
+    template <std::size_t Bytes, std::size_t Capacity>
+    using VectorAllocator = containers::ReservedPoolAllocator<Payload<Bytes>, Capacity, StoragePolicy>;
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using ListAllocator =
+        containers::ReservedPoolAllocator<Payload<Bytes>, Capacity, StoragePolicy, containers::FreeListRecycling>;
+};
+
+struct StackPoolFamily : PoolFamily<containers::StackStorage>
+{
+    static constexpr const char *NAME = "ReservedPoolAllocator<Stack>";
+};
+
+struct HeapPoolFamily : PoolFamily<containers::HeapStorage>
+{
+    static constexpr const char *NAME = "ReservedPoolAllocator<Heap>";
+};
+
+struct StdAllocatorFamily
+{
+    static constexpr const char *NAME = "std::allocator";
+
+    template <std::size_t Bytes, std::size_t Capacity> using VectorAllocator = std::allocator<Payload<Bytes>>;
+    template <std::size_t Bytes, std::size_t Capacity> using ListAllocator = std::allocator<Payload<Bytes>>;
+};
+
+const bool registered = (bench::registerAllSizes<AllocatorOperations<StackPoolFamily>>(),
+                         bench::registerAllSizes<AllocatorOperations<HeapPoolFamily>>(),
+                         bench::registerAllSizes<AllocatorOperations<StdAllocatorFamily>>(), true);
+} // namespace
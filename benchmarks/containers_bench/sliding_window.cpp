@@ -0,0 +1,283 @@
+#include "harness.hpp"
+#include "sliding_window.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Tick = containers::Tick<double>;
+
+// Ticks pushed per iteration, independent of the window so the rescan of large windows stays measurable
+constexpr std::size_t TICKS_PER_ITERATION = 1024U;
+
+// Length of the price series, cycled through by every benchmark
+constexpr std::size_t SERIES_LENGTH = 1U << 16U;
+
+// Random walk around 100 with random volumes
+const std::vector<Tick> &series()
+{
+    static const std::vector<Tick> ticks = []() {
+        std::mt19937_64 rng{42U};
+        std::normal_distribution<double> step{0.0, 0.01};
+        std::uniform_real_distribution<double> size{1.0, 100.0};
+
+        std::vector<Tick> result(SERIES_LENGTH);
+        double price = 100.0;
+        for (Tick &tick : result)
+        {
+            price += step(rng);
+            tick = Tick{price, size(rng)};
+        }
+        return result;
+    }();
+    return ticks;
+}
+
+struct MaxMonoid
+{
+    using value_type = double;
+
+    static double identity()
+    {
+        return -std::numeric_limits<double>::infinity();
+    }
+
+    static double combine(const double older, const double newer)
+    {
+        return std::max(older, newer);
+    }
+};
+
+// Each aggregate names the incremental container, how a tick is pushed into it and queried, and how a full rescan of
+// the window computes the same value
+struct SumAggregate
+{
+    static constexpr const char *NAME = "sum";
+    static constexpr const char *CONTAINER = "RollingStatistics";
+
+    template <std::size_t Window> using Incremental = containers::RollingStatistics<double, Window>;
+
+    template <typename Window> static double update(Window &window, const Tick &tick)
+    {
+        window.push(tick.price);
+        return window.sum();
+    }
+
+    template <typename Segment> static double rescan(const Segment first, const Segment second)
+    {
+        double sum = 0.0;
+        for (const Tick &tick : first)
+        {
+            sum += tick.price;
+        }
+        for (const Tick &tick : second)
+        {
+            sum += tick.price;
+        }
+        return sum;
+    }
+};
+
+struct MinMaxAggregate
+{
+    static constexpr const char *NAME = "min_max";
+    static constexpr const char *CONTAINER = "RollingStatistics";
+
+    template <std::size_t Window> using Incremental = containers::RollingStatistics<double, Window>;
+
+    template <typename Window> static double update(Window &window, const Tick &tick)
+    {
+        window.push(tick.price);
+        return window.min() + window.max();
+    }
+
+    template <typename Segment> static double rescan(const Segment first, const Segment second)
+    {
+        double low = first.front().price;
+        double high = low;
+        for (const Tick &tick : first)
+        {
+            low = std::min(low, tick.price);
+            high = std::max(high, tick.price);
+        }
+        for (const Tick &tick : second)
+        {
+            low = std::min(low, tick.price);
+            high = std::max(high, tick.price);
+        }
+        return low + high;
+    }
+};
+
+struct VarianceAggregate
+{
+    static constexpr const char *NAME = "variance";
+    static constexpr const char *CONTAINER = "RollingStatistics";
+
+    template <std::size_t Window> using Incremental = containers::RollingStatistics<double, Window>;
+
+    template <typename Window> static double update(Window &window, const Tick &tick)
+    {
+        window.push(tick.price);
+        return window.variance();
+    }
+
+    // Two passes, as a full recompute would do for accuracy
+    template <typename Segment> static double rescan(const Segment first, const Segment second)
+    {
+        const double count = static_cast<double>(first.size() + second.size());
+        const double mean = SumAggregate::rescan(first, second) / count;
+        double squares = 0.0;
+        for (const Tick &tick : first)
+        {
+            squares += (tick.price - mean) * (tick.price - mean);
+        }
+        for (const Tick &tick : second)
+        {
+            squares += (tick.price - mean) * (tick.price - mean);
+        }
+        return (count > 1.0) ? (squares / (count - 1.0)) : 0.0;
+    }
+};
+
+struct VwapAggregate
+{
+    static constexpr const char *NAME = "vwap";
+    static constexpr const char *CONTAINER = "RollingVwap";
+
+    template <std::size_t Window> using Incremental = containers::RollingVwap<double, Window>;
+
+    template <typename Window> static double update(Window &window, const Tick &tick)
+    {
+        window.push(tick.price, tick.volume);
+        return window.vwap();
+    }
+
+    template <typename Segment> static double rescan(const Segment first, const Segment second)
+    {
+        double notional = 0.0;
+        double volume = 0.0;
+        for (const Tick &tick : first)
+        {
+            notional += tick.price * tick.volume;
+            volume += tick.volume;
+        }
+        for (const Tick &tick : second)
+        {
+            notional += tick.price * tick.volume;
+            volume += tick.volume;
+        }
+        return notional / volume;
+    }
+};
+
+struct MonoidMaxAggregate
+{
+    static constexpr const char *NAME = "monoid_max";
+    static constexpr const char *CONTAINER = "WindowAggregator";
+
+    template <std::size_t Window> using Incremental = containers::WindowAggregator<double, Window, MaxMonoid>;
+
+    template <typename Window> static double update(Window &window, const Tick &tick)
+    {
+        window.push(tick.price);
+        return window.query();
+    }
+
+    template <typename Segment> static double rescan(const Segment first, const Segment second)
+    {
+        double high = MaxMonoid::identity();
+        for (const Tick &tick : first)
+        {
+            high = std::max(high, tick.price);
+        }
+        for (const Tick &tick : second)
+        {
+            high = std::max(high, tick.price);
+        }
+        return high;
+    }
+};
+
+// Updates the aggregate in O(1) per tick; the window is full before the clock starts
+template <typename Aggregate, std::size_t Window> void incremental(bench::State &state)
+{
+    const auto window = std::make_unique<typename Aggregate::template Incremental<Window>>();
+    const std::vector<Tick> &ticks = series();
+    std::size_t next = 0U;
+    for (; next < Window; ++next)
+    {
+        Aggregate::update(*window, ticks[next % SERIES_LENGTH]);
+    }
+
+    while (state.keepRunning())
+    {
+        double total = 0.0;
+        for (std::size_t i = 0U; i < TICKS_PER_ITERATION; ++i)
+        {
+            total += Aggregate::update(*window, ticks[next % SERIES_LENGTH]);
+            ++next;
+        }
+        bench::doNotOptimize(total);
+    }
+
+    state.setItemsPerIteration(TICKS_PER_ITERATION);
+    state.setBytesPerItem(sizeof(Tick));
+}
+
+// Keeps the ticks in a plain CircularBuffer and rescans the whole window on every tick
+template <typename Aggregate, std::size_t Window> void rescan(bench::State &state)
+{
+    const auto window = std::make_unique<containers::CircularBuffer<Tick, Window>>(
+        containers::OverflowBehaviour::OVERFLOW_OLDEST);
+    const std::vector<Tick> &ticks = series();
+    std::size_t next = 0U;
+    for (; next < Window; ++next)
+    {
+        window->push(ticks[next % SERIES_LENGTH]);
+    }
+
+    while (state.keepRunning())
+    {
+        double total = 0.0;
+        for (std::size_t i = 0U; i < TICKS_PER_ITERATION; ++i)
+        {
+            window->push(ticks[next % SERIES_LENGTH]);
+            ++next;
+            const auto segments = std::as_const(*window).segments();
+            total += Aggregate::rescan(segments.first, segments.second);
+        }
+        bench::doNotOptimize(total);
+    }
+
+    state.setItemsPerIteration(TICKS_PER_ITERATION);
+    state.setBytesPerItem(sizeof(Tick));
+}
+
+template <typename Aggregate> struct WindowOperations
+{
+    template <std::size_t Bytes, std::size_t Window> static void run()
+    {
+        bench::add(Aggregate::NAME, Aggregate::CONTAINER, Bytes, Window, incremental<Aggregate, Window>);
+        bench::add(Aggregate::NAME, "rescan", Bytes, Window, rescan<Aggregate, Window>);
+    }
+};
+
+// Ticks only, the capacity is the window length
+template <typename F> void registerWindowSizes()
+{
+    bench::ForSizes<F, sizeof(Tick)>::template capacities<64U, 1024U, 8192U>();
+}
+
+const bool registered = (registerWindowSizes<WindowOperations<SumAggregate>>(),
+                         registerWindowSizes<WindowOperations<MinMaxAggregate>>(),
+                         registerWindowSizes<WindowOperations<VarianceAggregate>>(),
+                         registerWindowSizes<WindowOperations<VwapAggregate>>(),
+                         registerWindowSizes<WindowOperations<MonoidMaxAggregate>>(), true);
+} // namespace
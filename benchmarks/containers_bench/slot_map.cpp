@@ -0,0 +1,228 @@
+#include "harness.hpp"
+#include "slot_map.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+// A typical session record
+struct Session
+{
+    std::uint64_t id;
+    std::uint64_t last_seen;
+    double balance;
+    std::uint32_t flags;
+};
+
+// Adapters so the same benchmark bodies drive both containers: the slot map is keyed by the handles it hands out,
+// the hash map by sequential session IDs
+template <std::size_t Capacity> struct SlotMapStore
+{
+    using Map = containers::HeapSlotMap<Session, Capacity>;
+    using Key = typename Map::Handle;
+
+    inline Key insert(const Session &session)
+    {
+        return map.insert(session);
+    }
+
+    inline const Session &find(const Key key) const noexcept
+    {
+        return *map.find(key);
+    }
+
+    inline void erase(const Key key)
+    {
+        map.erase(key);
+    }
+
+    inline void clear() noexcept
+    {
+        map.clear();
+    }
+
+    template <typename Visitor> inline void forEach(Visitor &&visitor) const
+    {
+        for (const Session &session : map)
+        {
+            visitor(session);
+        }
+    }
+
+    Map map;
+};
+
+template <std::size_t Capacity> struct HashMapStore
+{
+    using Key = std::uint64_t;
+
+    HashMapStore()
+    {
+        map.reserve(Capacity);
+    }
+
+    inline Key insert(const Session &session)
+    {
+        map.emplace(session.id, session);
+        return session.id;
+    }
+
+    inline const Session &find(const Key key) const
+    {
+        return map.find(key)->second;
+    }
+
+    inline void erase(const Key key)
+    {
+        map.erase(key);
+    }
+
+    inline void clear() noexcept
+    {
+        map.clear();
+    }
+
+    template <typename Visitor> inline void forEach(Visitor &&visitor) const
+    {
+        for (const auto &[id, session] : map)
+        {
+            visitor(session);
+        }
+    }
+
+    std::unordered_map<Key, Session> map;
+};
+
+// Fills the store to capacity and returns the keys in a shuffled order
+template <typename Store, std::size_t Capacity> std::vector<typename Store::Key> fill(Store &store)
+{
+    std::vector<typename Store::Key> keys;
+    keys.reserve(Capacity);
+    for (std::uint64_t i = 0U; i < Capacity; ++i)
+    {
+        keys.push_back(store.insert(Session{i, 0U, 0.0, 0U}));
+    }
+
+    std::mt19937_64 rng{42U};
+    std::shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+}
+
+// Fills the store from empty, the clear is not timed
+template <typename Store, std::size_t Capacity> void insert(bench::State &state)
+{
+    const auto store = std::make_unique<Store>();
+
+    while (state.keepRunning())
+    {
+        for (std::uint64_t i = 0U; i < Capacity; ++i)
+        {
+            bench::doNotOptimize(store->insert(Session{i, 0U, 0.0, 0U}));
+        }
+        state.pauseTiming();
+        store->clear();
+        state.resumeTiming();
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Session));
+}
+
+// Looks up every session of a full store in a random order
+template <typename Store, std::size_t Capacity> void lookup(bench::State &state)
+{
+    const auto store = std::make_unique<Store>();
+    const auto keys = fill<Store, Capacity>(*store);
+
+    while (state.keepRunning())
+    {
+        std::uint64_t sum = 0U;
+        for (const auto key : keys)
+        {
+            sum += store->find(key).id;
+        }
+        bench::doNotOptimize(sum);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Session));
+}
+
+template <typename Store, std::size_t Capacity> void iterate(bench::State &state)
+{
+    const auto store = std::make_unique<Store>();
+    fill<Store, Capacity>(*store);
+
+    while (state.keepRunning())
+    {
+        std::uint64_t sum = 0U;
+        store->forEach([&sum](const Session &session) { sum += session.last_seen; });
+        bench::doNotOptimize(sum);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Session));
+}
+
+// Closes a random session and opens a new one, the store stays full
+template <typename Store, std::size_t Capacity> void churn(bench::State &state)
+{
+    const auto store = std::make_unique<Store>();
+    auto keys = fill<Store, Capacity>(*store);
+    std::uint64_t next_id = Capacity;
+
+    while (state.keepRunning())
+    {
+        for (auto &key : keys)
+        {
+            store->erase(key);
+            key = store->insert(Session{next_id, 1U, 0.0, 0U});
+            ++next_id;
+        }
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Session));
+}
+
+template <typename Family> struct MapOperations
+{
+    template <std::size_t Bytes, std::size_t Capacity> static void run()
+    {
+        using Store = typename Family::template Store<Capacity>;
+        bench::add("insert", Family::NAME, Bytes, Capacity, insert<Store, Capacity>);
+        bench::add("lookup", Family::NAME, Bytes, Capacity, lookup<Store, Capacity>);
+        bench::add("iterate", Family::NAME, Bytes, Capacity, iterate<Store, Capacity>);
+        bench::add("churn", Family::NAME, Bytes, Capacity, churn<Store, Capacity>);
+    }
+};
+
+struct SlotMapFamily
+{
+    static constexpr const char *NAME = "SlotMap";
+
+    template <std::size_t Capacity> using Store = SlotMapStore<Capacity>;
+};
+
+struct UnorderedMapFamily
+{
+    static constexpr const char *NAME = "std::unordered_map";
+
+    template <std::size_t Capacity> using Store = HashMapStore<Capacity>;
+};
+
+// Session records only
+template <typename F> void registerMapSizes()
+{
+    bench::ForSizes<F, sizeof(Session)>::template capacities<1024U, 16384U, 65536U>();
+}
+
+const bool registered =
+    (registerMapSizes<MapOperations<SlotMapFamily>>(), registerMapSizes<MapOperations<UnorderedMapFamily>>(), true);
+} // namespace
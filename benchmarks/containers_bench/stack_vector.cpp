@@ -0,0 +1,17 @@
+#include "stack_vector.hpp"
+#include "vector_benchmarks.hpp"
+
+// The standalone StackVector lives in its own translation unit because generic_vector.hpp defines an alias of the
+// same name
+namespace
+{
+struct StackVectorFamily
+{
+    static constexpr const char *NAME = "StackVector";
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Container = containers::StackVector<bench::Payload<Bytes>, Capacity>;
+};
+
+const bool registered = (bench::registerAllSizes<bench::VectorOperations<StackVectorFamily>>(), true);
+} // namespace
@@ -0,0 +1,115 @@
+#include "static_deque.hpp"
+#include "vector_benchmarks.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+
+namespace
+{
+template <std::size_t Bytes> using Payload = bench::Payload<Bytes>;
+
+// Fills the container from the front and clears it again
+template <typename Deque, std::size_t Bytes, std::size_t Capacity> void pushFront(bench::State &state)
+{
+    const auto deque = std::make_unique<Deque>();
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            deque->push_front(Payload<Bytes>{i});
+        }
+        bench::doNotOptimize(*deque);
+        deque->clear();
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Sliding window: keeps the container half full, pushes at the back and pops at the front
+template <typename Deque, std::size_t Bytes, std::size_t Capacity> void slidingWindow(bench::State &state)
+{
+    const auto deque = std::make_unique<Deque>();
+    for (std::size_t i = 0U; i < (Capacity / 2U); ++i)
+    {
+        deque->push_back(Payload<Bytes>{i});
+    }
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            deque->push_back(Payload<Bytes>{i});
+            bench::doNotOptimize(deque->front());
+            deque->pop_front();
+        }
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Stack at the front end with a steady depth, e.g. the best levels of an order book
+template <typename Deque, std::size_t Bytes, std::size_t Capacity> void frontStack(bench::State &state)
+{
+    const auto deque = std::make_unique<Deque>();
+    for (std::size_t i = 0U; i < (Capacity / 2U); ++i)
+    {
+        deque->push_back(Payload<Bytes>{i});
+    }
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            deque->push_front(Payload<Bytes>{i});
+            bench::doNotOptimize(deque->back());
+            deque->pop_front();
+        }
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+template <typename Family> struct DequeOperations
+{
+    template <std::size_t Bytes, std::size_t Capacity> static void run()
+    {
+        using Container = typename Family::template Container<Bytes, Capacity>;
+        bench::VectorOperations<Family>::template run<Bytes, Capacity>();
+        bench::add("push_front", Family::NAME, Bytes, Capacity, pushFront<Container, Bytes, Capacity>);
+        bench::add("sliding_window", Family::NAME, Bytes, Capacity, slidingWindow<Container, Bytes, Capacity>);
+        bench::add("front_stack", Family::NAME, Bytes, Capacity, frontStack<Container, Bytes, Capacity>);
+    }
+};
+
+struct StackDequeFamily
+{
+    static constexpr const char *NAME = "StaticDeque<Stack>";
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Container = containers::StackDeque<Payload<Bytes>, Capacity>;
+};
+
+struct HeapDequeFamily
+{
+    static constexpr const char *NAME = "StaticDeque<Heap>";
+
+    template <std::size_t Bytes, std::size_t Capacity>
+    using Container = containers::HeapDeque<Payload<Bytes>, Capacity>;
+};
+
+struct StdDequeFamily
+{
+    static constexpr const char *NAME = "std::deque";
+
+    template <std::size_t Bytes, std::size_t Capacity> using Container = std::deque<Payload<Bytes>>;
+};
+
+const bool registered = (bench::registerAllSizes<DequeOperations<StackDequeFamily>>(),
+                         bench::registerAllSizes<DequeOperations<HeapDequeFamily>>(),
+                         bench::registerAllSizes<DequeOperations<StdDequeFamily>>(), true);
+} // namespace
@@ -0,0 +1,214 @@
+#include "harness.hpp"
+#include "static_priority_queue.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Min-heaps of timestamps, the timer use case
+using Key = std::uint64_t;
+
+struct StdQueue
+{
+    inline void push(const Key value)
+    {
+        queue.push(value);
+    }
+
+    inline Key pop()
+    {
+        const Key value = queue.top();
+        queue.pop();
+        return value;
+    }
+
+    template <typename InputIt> inline void push_range(InputIt first, InputIt last)
+    {
+        queue = std::priority_queue<Key, std::vector<Key>, std::greater<>>{std::greater<>{}, {first, last}};
+    }
+
+    inline void clear()
+    {
+        queue = {};
+    }
+
+    inline bool empty() const noexcept
+    {
+        return queue.empty();
+    }
+
+    std::priority_queue<Key, std::vector<Key>, std::greater<>> queue;
+};
+
+// Unordered keys spread over a range much wider than the queue, the same for every queue of one capacity
+std::vector<Key> makeKeys(const std::size_t count)
+{
+    std::mt19937_64 rng{42U};
+    std::vector<Key> keys(count);
+    for (Key &key : keys)
+    {
+        key = rng() % (count * 1'000'000U);
+    }
+    return keys;
+}
+
+template <typename Queue> void drain(Queue &queue)
+{
+    Key sum = 0U;
+    while (!queue.empty())
+    {
+        sum += queue.pop();
+    }
+    bench::doNotOptimize(sum);
+}
+
+// Fills the queue from empty, the drain is not timed
+template <typename Queue, std::size_t Capacity> void push(bench::State &state)
+{
+    const auto queue = std::make_unique<Queue>();
+    const std::vector<Key> keys = makeKeys(Capacity);
+
+    while (state.keepRunning())
+    {
+        for (const Key key : keys)
+        {
+            queue->push(key);
+        }
+        state.pauseTiming();
+        drain(*queue);
+        state.resumeTiming();
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Key));
+}
+
+// Drains a full queue, the fill is not timed
+template <typename Queue, std::size_t Capacity> void pop(bench::State &state)
+{
+    const auto queue = std::make_unique<Queue>();
+    const std::vector<Key> keys = makeKeys(Capacity);
+
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        for (const Key key : keys)
+        {
+            queue->push(key);
+        }
+        state.resumeTiming();
+        drain(*queue);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Key));
+}
+
+// Hold model: pops the earliest timer and reschedules it later, the size stays at the capacity
+template <typename Queue, std::size_t Capacity> void hold(bench::State &state)
+{
+    const auto queue = std::make_unique<Queue>();
+    for (const Key key : makeKeys(Capacity))
+    {
+        queue->push(key);
+    }
+
+    std::mt19937_64 rng{7U};
+    std::vector<Key> increments(4096U);
+    for (Key &increment : increments)
+    {
+        increment = rng() % 1'000'000U;
+    }
+
+    std::size_t next = 0U;
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            queue->push(queue->pop() + increments[next]);
+            next = (next + 1U) % increments.size();
+        }
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Key));
+}
+
+// Bulk construction from unordered keys
+template <typename Queue, std::size_t Capacity> void build(bench::State &state)
+{
+    const auto queue = std::make_unique<Queue>();
+    const std::vector<Key> keys = makeKeys(Capacity);
+
+    while (state.keepRunning())
+    {
+        queue->push_range(keys.begin(), keys.end());
+        state.pauseTiming();
+        queue->clear();
+        state.resumeTiming();
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(sizeof(Key));
+}
+
+template <typename Family> struct QueueOperations
+{
+    template <std::size_t Bytes, std::size_t Capacity> static void run()
+    {
+        using Queue = typename Family::template Queue<Capacity>;
+        bench::add("push", Family::NAME, Bytes, Capacity, push<Queue, Capacity>);
+        bench::add("pop", Family::NAME, Bytes, Capacity, pop<Queue, Capacity>);
+        bench::add("hold", Family::NAME, Bytes, Capacity, hold<Queue, Capacity>);
+        bench::add("build", Family::NAME, Bytes, Capacity, build<Queue, Capacity>);
+    }
+};
+
+struct BinaryFamily
+{
+    static constexpr const char *NAME = "StaticPriorityQueue<2>";
+
+    template <std::size_t Capacity>
+    using Queue = containers::StaticPriorityQueue<Key, Capacity, std::greater<>, containers::HeapAllocationPolicy, 2U>;
+};
+
+struct FourAryFamily
+{
+    static constexpr const char *NAME = "StaticPriorityQueue<4>";
+
+    template <std::size_t Capacity> using Queue = containers::HeapPriorityQueue<Key, Capacity, std::greater<>>;
+};
+
+struct TrackedFamily
+{
+    static constexpr const char *NAME = "StaticPriorityQueue<4,Tracked>";
+
+    template <std::size_t Capacity>
+    using Queue = containers::StaticPriorityQueue<Key, Capacity, std::greater<>, containers::HeapAllocationPolicy, 4U,
+                                                  containers::TrackedHandles>;
+};
+
+struct StdPriorityQueueFamily
+{
+    static constexpr const char *NAME = "std::priority_queue";
+
+    template <std::size_t Capacity> using Queue = StdQueue;
+};
+
+// Keys only, up to a queue well beyond the caches
+template <typename F> void registerQueueSizes()
+{
+    bench::ForSizes<F, sizeof(Key)>::template capacities<1024U, 16384U, 1048576U>();
+}
+
+const bool registered = (registerQueueSizes<QueueOperations<BinaryFamily>>(),
+                         registerQueueSizes<QueueOperations<FourAryFamily>>(),
+                         registerQueueSizes<QueueOperations<TrackedFamily>>(),
+                         registerQueueSizes<QueueOperations<StdPriorityQueueFamily>>(), true);
+} // namespace
@@ -0,0 +1,129 @@
+#ifndef CONTAINERS_BENCH_VECTOR_BENCHMARKS_HPP
+#define CONTAINERS_BENCH_VECTOR_BENCHMARKS_HPP
+
+#include "harness.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Operations shared by every vector-like container. Containers are created with make_unique, so fixed-capacity
+// containers with large inline storage do not overflow the stack; their storage is still inline in the object.
+namespace bench
+{
+template <typename Vector> inline void reserveFor(Vector &vector, const std::size_t capacity)
+{
+    if constexpr (requires { vector.reserve(capacity); })
+    {
+        vector.reserve(capacity);
+    }
+}
+
+// Fills the container to capacity and clears it again
+template <typename Vector, std::size_t Bytes, std::size_t Capacity> void pushBack(State &state)
+{
+    const auto vector = std::make_unique<Vector>();
+    reserveFor(*vector, Capacity);
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            vector->push_back(Payload<Bytes>{i});
+        }
+        doNotOptimize(*vector);
+        vector->clear();
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Reads the first word of every element of a full container
+template <typename Vector, std::size_t Bytes, std::size_t Capacity> void iterate(State &state)
+{
+    const auto vector = std::make_unique<Vector>();
+    reserveFor(*vector, Capacity);
+    for (std::size_t i = 0U; i < Capacity; ++i)
+    {
+        vector->push_back(Payload<Bytes>{i});
+    }
+
+    while (state.keepRunning())
+    {
+        std::uint64_t sum = 0U;
+        for (const auto &element : *vector)
+        {
+            sum += element.words[0];
+        }
+        doNotOptimize(sum);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Visits the elements of a full container in a scattered order through operator[]
+template <typename Vector, std::size_t Bytes, std::size_t Capacity> void randomAccess(State &state)
+{
+    const auto vector = std::make_unique<Vector>();
+    reserveFor(*vector, Capacity);
+    for (std::size_t i = 0U; i < Capacity; ++i)
+    {
+        vector->push_back(Payload<Bytes>{i});
+    }
+
+    // An odd stride visits every index of a power-of-two capacity exactly once
+    constexpr std::size_t STRIDE = 7919U;
+    while (state.keepRunning())
+    {
+        std::uint64_t sum = 0U;
+        std::size_t index = 0U;
+        for (std::size_t i = 0U; i < Capacity; ++i)
+        {
+            sum += (*vector)[index].words[0];
+            index = (index + STRIDE) & (Capacity - 1U);
+        }
+        doNotOptimize(sum);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Copy-constructs a full container, including the allocation of the new container object
+template <typename Vector, std::size_t Bytes, std::size_t Capacity> void copy(State &state)
+{
+    const auto vector = std::make_unique<Vector>();
+    reserveFor(*vector, Capacity);
+    for (std::size_t i = 0U; i < Capacity; ++i)
+    {
+        vector->push_back(Payload<Bytes>{i});
+    }
+
+    while (state.keepRunning())
+    {
+        const auto duplicate = std::make_unique<Vector>(*vector);
+        doNotOptimize(*duplicate);
+    }
+
+    state.setItemsPerIteration(Capacity);
+    state.setBytesPerItem(Bytes);
+}
+
+// Registers all vector operations for a container description with a NAME and a Container<Bytes, Capacity> alias
+template <typename Family> struct VectorOperations
+{
+    template <std::size_t Bytes, std::size_t Capacity> static void run()
+    {
+        using Container = typename Family::template Container<Bytes, Capacity>;
+        add("push_back", Family::NAME, Bytes, Capacity, pushBack<Container, Bytes, Capacity>);
+        add("iterate", Family::NAME, Bytes, Capacity, iterate<Container, Bytes, Capacity>);
+        add("random_access", Family::NAME, Bytes, Capacity, randomAccess<Container, Bytes, Capacity>);
+        add("copy", Family::NAME, Bytes, Capacity, copy<Container, Bytes, Capacity>);
+    }
+};
+} // namespace bench
+
+#endif // CONTAINERS_BENCH_VECTOR_BENCHMARKS_HPP
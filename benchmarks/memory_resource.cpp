@@ -0,0 +1,86 @@
+#include "memory_resource.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t ARENA_BYTES = 1U << 20U;
+
+// Keeps the compiler from discarding the benchmarked work
+volatile std::uint64_t sink;
+
+// A typical request: parse some tokens into strings, index them in a map and collect results in a vector
+void handleRequest(std::pmr::memory_resource *resource, const std::uint64_t request)
+{
+    std::pmr::vector<std::pmr::string> tokens{resource};
+    std::pmr::unordered_map<std::uint64_t, std::pmr::string> index{resource};
+    std::pmr::vector<std::uint64_t> results{resource};
+
+    for (std::uint64_t i = 0U; i < 64U; ++i)
+    {
+        tokens.emplace_back("token-that-does-not-fit-into-sso-" + std::to_string(request + i));
+        index.emplace(i, tokens.back());
+        results.push_back(tokens.back().size());
+    }
+
+    std::uint64_t sum = 0U;
+    for (const auto value : results)
+    {
+        sum += value;
+    }
+    sink = sum + index.size();
+}
+
+template <typename Function> double nsPerRequest(const std::uint64_t requests, Function &&function)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    for (std::uint64_t request = 0U; request < requests; ++request)
+    {
+        function(request);
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(requests);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t requests = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 100'000U;
+
+    const auto monotonic = std::make_unique<containers::HeapMonotonicResource<ARENA_BYTES>>();
+    const auto pooled = std::make_unique<containers::HeapPooledResource<ARENA_BYTES>>();
+
+    const double new_delete = nsPerRequest(
+        requests, [](const std::uint64_t request) { handleRequest(std::pmr::new_delete_resource(), request); });
+
+    const double monotonic_reset = nsPerRequest(requests, [&](const std::uint64_t request) {
+        handleRequest(monotonic.get(), request);
+        monotonic->release();
+    });
+
+    const double pooled_reset = nsPerRequest(requests, [&](const std::uint64_t request) {
+        handleRequest(pooled.get(), request);
+        pooled->release();
+    });
+
+    const double pooled_reuse =
+        nsPerRequest(requests, [&](const std::uint64_t request) { handleRequest(pooled.get(), request); });
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "resource ns/request" << std::endl;
+    std::cout << "new_delete " << new_delete << std::endl;
+    std::cout << "monotonic_release " << monotonic_reset << std::endl;
+    std::cout << "pooled_release " << pooled_reset << std::endl;
+    std::cout << "pooled_reuse " << pooled_reuse << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include "mpmc_circular_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t BUFFER_SIZE = 4096U;
+
+struct Job
+{
+    std::uint64_t id{0U};
+    std::int64_t timestamp_ns{0};
+};
+
+using Buffer = containers::MpmcCircularBuffer<Job, BUFFER_SIZE>;
+
+inline std::int64_t nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Spin for a short while before yielding, so the benchmark still makes progress on machines with fewer cores than
+// threads
+inline void backoff(std::uint32_t &spins) noexcept
+{
+    if (++spins < 64U)
+    {
+        return;
+    }
+
+    spins = 0U;
+    std::this_thread::yield();
+}
+
+struct Result
+{
+    double ops_per_second;
+    std::int64_t p50_ns;
+    std::int64_t p99_ns;
+};
+
+// Every producer pushes messages_per_producer jobs, consumers pop until all jobs have been seen. Latency is measured
+// from push to pop and therefore includes the time spent queued.
+Result run(const std::size_t producers, const std::size_t consumers, const std::uint64_t messages_per_producer)
+{
+    const auto buffer = std::make_unique<Buffer>();
+    const std::uint64_t total_messages = messages_per_producer * producers;
+
+    std::atomic<bool> start{false};
+    std::atomic<std::uint64_t> consumed{0U};
+    std::vector<std::vector<std::int64_t>> samples(consumers);
+    std::vector<std::thread> threads;
+
+    for (std::size_t c = 0U; c < consumers; ++c)
+    {
+        samples[c].reserve(total_messages / consumers + 1U);
+        threads.emplace_back([&, c]() {
+            while (!start.load(std::memory_order_acquire))
+            {
+            }
+
+            Job job;
+            std::uint32_t spins = 0U;
+            while (consumed.load(std::memory_order_relaxed) < total_messages)
+            {
+                if (buffer->try_pop(job))
+                {
+                    samples[c].push_back(nowNs() - job.timestamp_ns);
+                    consumed.fetch_add(1U, std::memory_order_relaxed);
+                }
+                else
+                {
+                    backoff(spins);
+                }
+            }
+        });
+    }
+
+    for (std::size_t p = 0U; p < producers; ++p)
+    {
+        threads.emplace_back([&]() {
+            while (!start.load(std::memory_order_acquire))
+            {
+            }
+
+            std::uint32_t spins = 0U;
+            for (std::uint64_t i = 0U; i < messages_per_producer;)
+            {
+                if (buffer->try_push(Job{i, nowNs()}))
+                {
+                    ++i;
+                }
+                else
+                {
+                    backoff(spins);
+                }
+            }
+        });
+    }
+
+    const auto t1 = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(total_messages);
+    for (const auto &consumer_samples : samples)
+    {
+        latencies.insert(latencies.end(), consumer_samples.begin(), consumer_samples.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    return Result{static_cast<double>(total_messages) / std::chrono::duration<double>(t2 - t1).count(),
+                  latencies[latencies.size() / 2U], latencies[(latencies.size() * 99U) / 100U]};
+}
+
+// Powers of two up to the number of cores, always finishing with the number of cores itself
+inline std::size_t nextThreadCount(const std::size_t count, const std::size_t cores) noexcept
+{
+    return ((count < cores) && ((count * 2U) > cores)) ? cores : (count * 2U);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t messages = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1'000'000U;
+    const std::size_t cores = std::max<std::size_t>(1U, std::thread::hardware_concurrency());
+
+    if (messages < 100U)
+    {
+        std::cerr << "Number of messages must be at least 100." << std::endl;
+        return 1;
+    }
+
+    std::cout << "producers consumers ops/s p50[ns] p99[ns]" << std::endl;
+
+    // Scale producers and consumers independently from 1 to the number of cores
+    for (std::size_t producers = 1U; producers <= cores; producers = nextThreadCount(producers, cores))
+    {
+        for (std::size_t consumers = 1U; consumers <= cores; consumers = nextThreadCount(consumers, cores))
+        {
+            const Result result = run(producers, consumers, messages / producers);
+            std::cout << producers << " " << consumers << " " << static_cast<std::uint64_t>(result.ops_per_second)
+                      << " " << result.p50_ns << " " << result.p99_ns << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "numa_storage.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace
+{
+constexpr std::size_t ELEMENTS = 16U * 1024U * 1024U;
+constexpr int ROUNDS = 5;
+
+using Storage = containers::NumaLocalStorage<std::uint64_t, ELEMENTS>;
+
+// Keeps the compiler from discarding the benchmarked work
+volatile std::uint64_t sink;
+
+struct Bandwidth
+{
+    double read_gb_per_second;
+    double write_gb_per_second;
+};
+
+Bandwidth measure(Storage &storage)
+{
+    std::uint64_t *const data = storage.buffer();
+    constexpr double BYTES = static_cast<double>(ELEMENTS * sizeof(std::uint64_t) * ROUNDS);
+
+    const auto t1 = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        for (std::size_t i = 0U; i < ELEMENTS; ++i)
+        {
+            data[i] = i + static_cast<std::uint64_t>(round);
+        }
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::uint64_t sum = 0U;
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        for (std::size_t i = 0U; i < ELEMENTS; ++i)
+        {
+            sum += data[i];
+        }
+    }
+    const auto t3 = std::chrono::steady_clock::now();
+    sink = sum;
+
+    return Bandwidth{BYTES / std::chrono::duration<double, std::nano>(t3 - t2).count(),
+                     BYTES / std::chrono::duration<double, std::nano>(t2 - t1).count()};
+}
+
+// Keeps the calling thread on the CPU it currently runs on, so its node does not change during the measurement
+void pinToCurrentCpu() noexcept
+{
+#if defined(__linux__)
+    const int cpu = ::sched_getcpu();
+    if (cpu >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        static_cast<void>(::sched_setaffinity(0, sizeof(set), &set));
+    }
+#endif
+}
+
+void report(const char *name, Storage &storage)
+{
+    const Bandwidth bandwidth = measure(storage);
+    std::cout << name << " " << storage.node() << " " << (storage.bound() ? "yes" : "no") << " "
+              << bandwidth.read_gb_per_second << " " << bandwidth.write_gb_per_second << std::endl;
+}
+} // namespace
+
+int main()
+{
+    std::thread worker([]() {
+        pinToCurrentCpu();
+
+        const int nodes = containers::numa::nodeCount();
+        const int local = containers::numa::currentNode();
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Worker runs on node " << local << " of " << nodes << std::endl;
+        std::cout << "placement node bound read[GB/s] write[GB/s]" << std::endl;
+
+        auto local_storage = std::make_unique<Storage>(local);
+        report("local", *local_storage);
+        local_storage.reset();
+
+        if (nodes < 2)
+        {
+            std::cout << "Single NUMA node, skipping remote and interleaved placement" << std::endl;
+            return;
+        }
+
+        auto remote_storage = std::make_unique<Storage>((local + 1) % nodes);
+        report("remote", *remote_storage);
+        remote_storage.reset();
+
+        auto interleaved_storage = std::make_unique<Storage>(containers::NUMA_INTERLEAVED);
+        report("interleaved", *interleaved_storage);
+    });
+
+    worker.join();
+    return 0;
+}
@@ -0,0 +1,254 @@
+#include "generic_vector.hpp"
+#include "simd_algorithms.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+namespace simd = containers::simd;
+
+constexpr simd::Isa LEVELS[] = {simd::Isa::SCALAR, simd::Isa::SSE2, simd::Isa::AVX2, simd::Isa::AVX512};
+
+const char *isaName(const simd::Isa level)
+{
+    switch (level)
+    {
+    case simd::Isa::SSE2:
+        return "sse2";
+    case simd::Isa::AVX2:
+        return "avx2";
+    case simd::Isa::AVX512:
+        return "avx512";
+    default:
+        return "scalar";
+    }
+}
+
+// Keeps the compiler from discarding the benchmarked work
+volatile std::size_t sink;
+
+int failures = 0;
+
+void check(const bool condition, const char *what, const char *type, const simd::Isa level, const std::size_t size)
+{
+    if (!condition)
+    {
+        std::cerr << "Mismatch: " << what << " <" << type << "> " << isaName(level) << " size " << size << '\n';
+        ++failures;
+    }
+}
+
+// Compares every algorithm against its std:: counterpart for all sizes up to 300, which covers empty input, partial
+// vectors and tails of every length, with the needle at every position class
+template <typename T> void verify(const char *type, const simd::Isa level)
+{
+    std::mt19937_64 random{7U};
+    std::vector<T> data;
+    for (std::size_t size = 0U; size <= 300U; ++size)
+    {
+        data.resize(size);
+        for (T &value : data)
+        {
+            // Few distinct values so count sees plenty of hits, and negative values for the signed types
+            value = static_cast<T>(static_cast<std::int64_t>(random() % 64U) - 16);
+        }
+
+        for (const T needle : {data.empty() ? T{0} : data.back(), data.empty() ? T{1} : data.front(), T{99}})
+        {
+            check(simd::find(data.data(), size, needle) ==
+                      static_cast<std::size_t>(std::find(data.begin(), data.end(), needle) - data.begin()),
+                  "find", type, level, size);
+            check(simd::count(data.data(), size, needle) ==
+                      static_cast<std::size_t>(std::count(data.begin(), data.end(), needle)),
+                  "count", type, level, size);
+        }
+
+        if (size > 0U)
+        {
+            check(simd::min(data.data(), size) == *std::min_element(data.begin(), data.end()), "min", type, level,
+                  size);
+            check(simd::max(data.data(), size) == *std::max_element(data.begin(), data.end()), "max", type, level,
+                  size);
+
+            std::vector<T> other{data};
+            check(simd::equal(data.data(), other.data(), size), "equal", type, level, size);
+            other[random() % size] = T{100};
+            check(!simd::equal(data.data(), other.data(), size), "not equal", type, level, size);
+        }
+
+        // Fill an interior range so that writes past either end would show up in the guard values
+        std::vector<T> filled(size + 2U, T{100});
+        simd::fill(filled.data() + 1U, size, T{30});
+        check((filled.front() == T{100}) && (filled.back() == T{100}) &&
+                  std::all_of(filled.begin() + 1, filled.end() - 1, [](const T value) { return value == T{30}; }),
+              "fill", type, level, size);
+    }
+
+    // Extremes of the range, which the unsigned and 64-bit comparisons have to order correctly
+    const T extremes[] = {T{0}, std::numeric_limits<T>::lowest(), T{1}, std::numeric_limits<T>::max(), T{2},
+                          T{3},  T{4},                             T{5}, T{6},                         T{7},
+                          T{8},  T{9},                             T{10}, T{11},                       T{12},
+                          T{13}, T{14}};
+    check(simd::min(extremes, std::size(extremes)) == std::numeric_limits<T>::lowest(), "min extremes", type, level,
+          std::size(extremes));
+    check(simd::max(extremes, std::size(extremes)) == std::numeric_limits<T>::max(), "max extremes", type, level,
+          std::size(extremes));
+}
+
+// The unrolled fixed-capacity paths and the GenericVector overloads
+template <typename T> void verifyFixed(const char *type)
+{
+    constexpr std::size_t N = 16U;
+    containers::StackVector<T, N> full;
+    containers::HeapVector<T, N> copy;
+    for (std::size_t i = 0U; i < N; ++i)
+    {
+        full.push_back(static_cast<T>((i * 5U) % 7U));
+        copy.push_back(full[i]);
+    }
+
+    const std::span<const T, N> span{&full[0U], N};
+    check(simd::find(span, T{3}) == static_cast<std::size_t>(std::find(span.begin(), span.end(), T{3}) - span.begin()),
+          "fixed find", type, simd::Isa::SCALAR, N);
+    check(simd::find(span, T{42}) == N, "fixed find absent", type, simd::Isa::SCALAR, N);
+    check(simd::count(span, T{3}) == static_cast<std::size_t>(std::count(span.begin(), span.end(), T{3})),
+          "fixed count", type, simd::Isa::SCALAR, N);
+    check(simd::min(full) == *std::min_element(span.begin(), span.end()), "vector min", type, simd::Isa::SCALAR, N);
+    check(simd::max(full) == *std::max_element(span.begin(), span.end()), "vector max", type, simd::Isa::SCALAR, N);
+    check(simd::find(full, T{3}) == std::find(full.cbegin(), full.cend(), T{3}), "vector find", type,
+          simd::Isa::SCALAR, N);
+    check(simd::contains(full, T{6}) && !simd::contains(full, T{42}), "vector contains", type, simd::Isa::SCALAR, N);
+    check(simd::equal(full, copy), "vector equal", type, simd::Isa::SCALAR, N);
+    copy.pop_back();
+    check(!simd::equal(full, copy), "vector size mismatch", type, simd::Isa::SCALAR, N);
+    check(simd::count(copy, T{3}) == static_cast<std::size_t>(std::count(copy.cbegin(), copy.cend(), T{3})),
+          "partial vector count", type, simd::Isa::SCALAR, N - 1U);
+    simd::fill(full, T{9});
+    simd::fill(copy, T{9});
+    check((simd::count(full, T{9}) == N) && (simd::count(copy, T{9}) == (N - 1U)), "vector fill", type,
+          simd::Isa::SCALAR, N);
+}
+
+template <typename Function> double nsPerOp(const std::size_t operations, Function &&function)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    function();
+    const auto t2 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(operations);
+}
+
+// Nanoseconds per element for each algorithm, the needle is absent so find scans the whole array
+template <typename T> void run(const char *type, const std::size_t size, const int rounds)
+{
+    std::vector<T> data(size);
+    std::mt19937_64 random{42U};
+    for (T &value : data)
+    {
+        value = static_cast<T>(random() % 1000U);
+    }
+    const std::vector<T> other{data};
+    std::vector<T> target(size);
+    const std::size_t elements = size * static_cast<std::size_t>(rounds);
+
+    const double find = nsPerOp(elements, [&]() {
+        for (int round = 0; round < rounds; ++round)
+        {
+            sink = simd::find(data.data(), size, T{5000});
+        }
+    });
+    const double count = nsPerOp(elements, [&]() {
+        for (int round = 0; round < rounds; ++round)
+        {
+            sink = simd::count(data.data(), size, T{7});
+        }
+    });
+    const double min = nsPerOp(elements, [&]() {
+        for (int round = 0; round < rounds; ++round)
+        {
+            sink = static_cast<std::size_t>(simd::min(data.data(), size));
+        }
+    });
+    const double max = nsPerOp(elements, [&]() {
+        for (int round = 0; round < rounds; ++round)
+        {
+            sink = static_cast<std::size_t>(simd::max(data.data(), size));
+        }
+    });
+    const double equal = nsPerOp(elements, [&]() {
+        for (int round = 0; round < rounds; ++round)
+        {
+            sink = static_cast<std::size_t>(simd::equal(data.data(), other.data(), size));
+        }
+    });
+    const double fill = nsPerOp(elements, [&]() {
+        for (int round = 0; round < rounds; ++round)
+        {
+            simd::fill(target.data(), size, static_cast<T>(round));
+        }
+        sink = target.empty() ? 0U : static_cast<std::size_t>(target.back());
+    });
+
+    std::cout << std::left << std::setw(8) << type << std::setw(8) << isaName(simd::activeIsa()) << std::right
+              << std::fixed << std::setprecision(3) << std::setw(10) << find << std::setw(10) << count
+              << std::setw(10) << min << std::setw(10) << max << std::setw(10) << equal << std::setw(10) << fill
+              << '\n';
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const std::size_t size = (argc > 1) ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 4096U;
+    const int rounds = (argc > 2) ? std::atoi(argv[2]) : 20000;
+
+    std::cout << "Detected instruction set: " << isaName(simd::detectedIsa()) << "\n\n";
+
+    for (const simd::Isa level : LEVELS)
+    {
+        if (simd::setActiveIsa(level) != level)
+        {
+            continue;
+        }
+
+        verify<std::int32_t>("int32", level);
+        verify<std::uint32_t>("uint32", level);
+        verify<std::int64_t>("int64", level);
+        verify<std::uint64_t>("uint64", level);
+        verify<float>("float", level);
+        verify<double>("double", level);
+    }
+    verifyFixed<std::int32_t>("int32");
+    verifyFixed<double>("double");
+
+    if (failures > 0)
+    {
+        std::cerr << failures << " mismatches against the standard algorithms\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All results match the standard algorithms\n\n";
+
+    std::cout << "ns per element, " << size << " elements\n";
+    std::cout << "type    isa           find     count       min       max     equal      fill\n";
+    for (const simd::Isa level : LEVELS)
+    {
+        if (simd::setActiveIsa(level) != level)
+        {
+            continue;
+        }
+
+        run<std::int32_t>("int32", size, rounds);
+        run<std::int64_t>("int64", size, rounds);
+        run<float>("float", size, rounds);
+        run<double>("double", size, rounds);
+    }
+
+    return EXIT_SUCCESS;
+}
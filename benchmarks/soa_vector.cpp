@@ -0,0 +1,104 @@
+#include "generic_vector.hpp"
+#include "soa_vector.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+
+namespace
+{
+constexpr std::size_t RECORDS = 1U << 22U;
+constexpr int ROUNDS = 10;
+
+// A typical order record, the kernels below only read one or two of its fields
+struct Order
+{
+    double price;
+    double quantity;
+    std::int64_t id;
+    std::int64_t timestamp;
+    std::int32_t side;
+    std::int32_t venue;
+    char symbol[16];
+};
+
+using AoS = containers::HeapVector<Order, RECORDS>;
+using SoA = containers::HeapSoAVector<RECORDS, double, double, std::int64_t, std::int64_t, std::int32_t,
+                                      std::int32_t>;
+
+// Keeps the compiler from discarding the benchmarked work
+volatile double sink;
+
+template <typename Function> double nsPerElement(Function &&function)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        function();
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(RECORDS * ROUNDS);
+}
+} // namespace
+
+int main()
+{
+    const auto aos = std::make_unique<AoS>();
+    const auto soa = std::make_unique<SoA>();
+
+    std::mt19937_64 random{42U};
+    for (std::size_t i = 0U; i < RECORDS; ++i)
+    {
+        const double price = 100.0 + static_cast<double>(random() % 1000U) / 100.0;
+        const double quantity = static_cast<double>(random() % 100U);
+        const std::int32_t side = (random() % 2U == 0U) ? 1 : -1;
+        aos->push_back(Order{price, quantity, static_cast<std::int64_t>(i), 0, side, 0, {}});
+        soa->emplace_back(price, quantity, static_cast<std::int64_t>(i), std::int64_t{0}, side, std::int32_t{0});
+    }
+
+    const double aos_sum = nsPerElement([&]() {
+        double sum = 0.0;
+        for (const auto &order : *aos)
+        {
+            sum += order.price;
+        }
+        sink = sum;
+    });
+
+    const double soa_sum = nsPerElement([&]() {
+        double sum = 0.0;
+        for (const double price : soa->column<0>())
+        {
+            sum += price;
+        }
+        sink = sum;
+    });
+
+    // Buy orders get their price bumped, reads side and writes price
+    const double aos_update = nsPerElement([&]() {
+        for (auto &order : *aos)
+        {
+            order.price *= (order.side > 0) ? 1.0001 : 1.0;
+        }
+    });
+
+    const double soa_update = nsPerElement([&]() {
+        const auto prices = soa->column<0>();
+        const auto sides = soa->column<4>();
+        for (std::size_t i = 0U; i < prices.size(); ++i)
+        {
+            prices[i] *= (sides[i] > 0) ? 1.0001 : 1.0;
+        }
+    });
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "kernel aos[ns/element] soa[ns/element]" << std::endl;
+    std::cout << "column_sum " << aos_sum << " " << soa_sum << std::endl;
+    std::cout << "filtered_update " << aos_update << " " << soa_update << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+#include "circular_buffer.hpp"
+#include "spsc_circular_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t BUFFER_SIZE = 1024U;
+
+struct Tick
+{
+    std::uint64_t sequence{0U};
+    std::int64_t timestamp_ns{0};
+};
+
+inline std::int64_t nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Spin for a short while before yielding, so the benchmark still makes progress on machines with fewer cores than
+// threads
+inline void backoff(std::uint32_t &spins) noexcept
+{
+    if (++spins < 64U)
+    {
+        return;
+    }
+
+    spins = 0U;
+    std::this_thread::yield();
+}
+
+// Baseline: the single-threaded CircularBuffer protected by a mutex
+class MutexCircularBuffer
+{
+  public:
+    bool try_push(const Tick &tick)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return buffer_.try_push(tick);
+    }
+
+    bool try_pop(Tick &tick)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return buffer_.try_pop(tick);
+    }
+
+  private:
+    std::mutex mutex_;
+    containers::CircularBuffer<Tick, BUFFER_SIZE> buffer_;
+};
+
+template <typename Buffer> double measureThroughput(Buffer &buffer, const std::uint64_t messages)
+{
+    std::atomic<bool> start{false};
+
+    std::thread consumer{[&]() {
+        while (!start.load(std::memory_order_acquire))
+        {
+        }
+
+        Tick tick;
+        std::uint32_t spins = 0U;
+        for (std::uint64_t expected = 0U; expected < messages;)
+        {
+            if (buffer.try_pop(tick))
+            {
+                if (tick.sequence != expected)
+                {
+                    std::cerr << "Out of order tick: " << tick.sequence << " != " << expected << std::endl;
+                    std::abort();
+                }
+                ++expected;
+            }
+            else
+            {
+                backoff(spins);
+            }
+        }
+    }};
+
+    const auto t1 = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    std::uint32_t spins = 0U;
+    for (std::uint64_t i = 0U; i < messages;)
+    {
+        if (buffer.try_push(Tick{i, 0}))
+        {
+            ++i;
+        }
+        else
+        {
+            backoff(spins);
+        }
+    }
+
+    consumer.join();
+    const auto t2 = std::chrono::steady_clock::now();
+
+    return static_cast<double>(messages) / std::chrono::duration<double>(t2 - t1).count();
+}
+
+// One message in flight at a time: the producer waits for the consumer to acknowledge each tick, so the samples
+// measure one-way hand-off latency rather than queueing delay
+template <typename Buffer> std::vector<std::int64_t> measureLatency(Buffer &buffer, const std::uint64_t messages)
+{
+    std::vector<std::int64_t> samples(messages);
+    std::atomic<std::uint64_t> received{0U};
+
+    std::thread consumer{[&]() {
+        Tick tick;
+        std::uint32_t spins = 0U;
+        for (std::uint64_t i = 0U; i < messages;)
+        {
+            if (buffer.try_pop(tick))
+            {
+                samples[i] = nowNs() - tick.timestamp_ns;
+                received.store(++i, std::memory_order_release);
+            }
+            else
+            {
+                backoff(spins);
+            }
+        }
+    }};
+
+    std::uint32_t spins = 0U;
+    for (std::uint64_t i = 0U; i < messages; ++i)
+    {
+        while (!buffer.try_push(Tick{i, nowNs()}))
+        {
+            backoff(spins);
+        }
+        while (received.load(std::memory_order_acquire) <= i)
+        {
+            backoff(spins);
+        }
+    }
+
+    consumer.join();
+
+    std::sort(samples.begin(), samples.end());
+    return samples;
+}
+
+template <typename Buffer> void run(const char *name, const std::uint64_t messages)
+{
+    {
+        Buffer buffer;
+        const double throughput = measureThroughput(buffer, messages);
+        std::cout << name << " throughput [Mmsg/s]: " << (throughput / 1.0e6) << std::endl;
+    }
+
+    {
+        Buffer buffer;
+        const std::vector<std::int64_t> samples = measureLatency(buffer, messages / 10U);
+        std::cout << name << " latency [ns]: p50 " << samples[samples.size() / 2U] << ", p99 "
+                  << samples[(samples.size() * 99U) / 100U] << ", max " << samples.back() << std::endl;
+    }
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t messages = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1'000'000U;
+    if (messages < 10U)
+    {
+        std::cerr << "Number of messages must be at least 10." << std::endl;
+        return 1;
+    }
+
+    run<MutexCircularBuffer>("Mutex CircularBuffer", messages);
+    run<containers::SpscCircularBuffer<Tick, BUFFER_SIZE>>("SpscCircularBuffer", messages);
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include "static_hash_map.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t CAPACITY = 1U << 16U;
+
+using Map = containers::HeapHashMap<std::uint64_t, std::uint64_t, CAPACITY>;
+using StdMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+
+// Keeps the compiler from discarding the benchmarked work
+volatile std::uint64_t sink;
+
+template <typename Function> double nsPerOp(const std::size_t operations, Function &&function)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    function();
+    const auto t2 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(operations);
+}
+
+struct Result
+{
+    double insert;
+    double hit;
+    double miss;
+    double erase;
+};
+
+template <typename MapType>
+Result run(MapType &map, const std::vector<std::uint64_t> &keys, const std::vector<std::uint64_t> &missing_keys)
+{
+    Result result{};
+
+    result.insert = nsPerOp(keys.size(), [&]() {
+        for (const std::uint64_t key : keys)
+        {
+            map.try_emplace(key, key);
+        }
+    });
+
+    result.hit = nsPerOp(keys.size(), [&]() {
+        std::uint64_t sum = 0U;
+        for (const std::uint64_t key : keys)
+        {
+            sum += map.find(key)->second;
+        }
+        sink = sum;
+    });
+
+    result.miss = nsPerOp(missing_keys.size(), [&]() {
+        std::uint64_t found = 0U;
+        for (const std::uint64_t key : missing_keys)
+        {
+            found += static_cast<std::uint64_t>(map.find(key) != map.end());
+        }
+        sink = found;
+    });
+
+    result.erase = nsPerOp(keys.size(), [&]() {
+        for (const std::uint64_t key : keys)
+        {
+            map.erase(key);
+        }
+    });
+
+    return result;
+}
+
+void print(const char *name, const int load, const Result &result)
+{
+    std::cout << std::setw(20) << name << std::setw(6) << load << "%" << std::fixed << std::setprecision(2)
+              << std::setw(10) << result.insert << std::setw(10) << result.hit << std::setw(10) << result.miss
+              << std::setw(10) << result.erase << std::endl;
+}
+} // namespace
+
+int main()
+{
+    std::mt19937_64 rng{42U};
+
+    std::cout << std::setw(20) << "map" << std::setw(7) << "load" << std::setw(10) << "insert" << std::setw(10)
+              << "hit" << std::setw(10) << "miss" << std::setw(10) << "erase" << "  [ns/op]" << std::endl;
+
+    for (const int load : {50, 75, 90})
+    {
+        const std::size_t count = (Map::slotCount() * static_cast<std::size_t>(load)) / 100U;
+
+        std::vector<std::uint64_t> keys(count);
+        std::vector<std::uint64_t> missing_keys(count);
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            // Even keys are inserted, odd keys are guaranteed misses
+            keys[i] = rng() & ~std::uint64_t{1U};
+            missing_keys[i] = rng() | std::uint64_t{1U};
+        }
+
+        const auto map = std::make_unique<Map>();
+        print("StaticHashMap", load, run(*map, keys, missing_keys));
+
+        StdMap std_map;
+        std_map.reserve(count);
+        print("std::unordered_map", load, run(std_map, keys, missing_keys));
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "spsc_circular_buffer.hpp"
+#include "waiting_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t MESSAGES = 2000U;
+
+// Baseline: poll and sleep between attempts, the usual alternative to spinning
+struct SleepPollWait
+{
+    template <typename Ready> bool waitUntil(Ready &&ready, const std::chrono::steady_clock::time_point deadline)
+    {
+        while (!ready())
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds{100});
+        }
+        return true;
+    }
+
+    inline void notifyOne() noexcept
+    {
+    }
+
+    inline void notifyAll() noexcept
+    {
+    }
+};
+
+inline std::int64_t nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+inline double threadCpuNs() noexcept
+{
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return (static_cast<double>(time.tv_sec) * 1e9) + static_cast<double>(time.tv_nsec);
+}
+
+// The producer sends timestamped messages after random idle gaps, the consumer blocks in pop() and records how long
+// each message took to arrive, plus its own CPU time relative to the wall time
+template <typename WaitStrategy> void measure(const char *name)
+{
+    containers::WaitingBuffer<containers::SpscCircularBuffer<std::int64_t, 1024>, WaitStrategy> buffer;
+    std::vector<std::int64_t> latencies(MESSAGES);
+    double cpu_ns = 0.0;
+
+    const std::int64_t start = nowNs();
+    std::thread consumer{[&]() {
+        const double cpu_start = threadCpuNs();
+        for (std::size_t i = 0U; i < MESSAGES; ++i)
+        {
+            const std::int64_t sent = buffer.pop();
+            latencies[i] = nowNs() - sent;
+        }
+        cpu_ns = threadCpuNs() - cpu_start;
+    }};
+
+    std::mt19937 rng{42U};
+    std::uniform_int_distribution<int> gap_us{20, 200};
+    for (std::size_t i = 0U; i < MESSAGES; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds{gap_us(rng)});
+        while (!buffer.try_push(nowNs()))
+        {
+        }
+    }
+    consumer.join();
+    const double wall_ns = static_cast<double>(nowNs() - start);
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << std::setw(16) << name << std::fixed << std::setprecision(0) << std::setw(12)
+              << static_cast<double>(latencies[MESSAGES / 2U]) << std::setw(12)
+              << static_cast<double>(latencies[(MESSAGES * 99U) / 100U]) << std::setprecision(1) << std::setw(12)
+              << (100.0 * cpu_ns / wall_ns) << std::endl;
+}
+} // namespace
+
+int main()
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency()
+              << ", spinning strategies need a free core for the consumer" << std::endl;
+    std::cout << std::setw(16) << "strategy" << std::setw(12) << "p50 [ns]" << std::setw(12) << "p99 [ns]"
+              << std::setw(12) << "cpu [%]" << std::endl;
+
+    measure<containers::BusySpinWait>("busy spin");
+    measure<containers::SpinYieldWait<>>("spin + yield");
+    measure<containers::ParkingWait<>>("spin + park");
+    measure<containers::ParkingWait<0U>>("park");
+    measure<SleepPollWait>("sleep 100us");
+
+    return 0;
+}
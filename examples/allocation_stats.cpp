@@ -0,0 +1,82 @@
+#include "allocation_stats.hpp"
+#include "circular_buffer.hpp"
+#include "generic_vector.hpp"
+#include "reserved_pool_allocator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <thread>
+
+struct Orders
+{
+};
+
+int main()
+{
+    // Per-object stats, read through stats()
+    containers::ReservedPoolAllocator<double, 1024, containers::StackStorage, containers::FreeListRecycling,
+                                      containers::CollectStats>
+        allocator;
+    double *block = allocator.allocate(100U);
+    double *small = allocator.allocate(3U);
+    allocator.deallocate(block, 100U);
+    block = allocator.allocate(60U);
+
+    const containers::PoolStatsSnapshot pool = allocator.stats();
+    std::cout << "Pool: current " << pool.current_bytes << " B, peak " << pool.peak_bytes << " B, peak pool "
+              << pool.peak_pool_bytes << " B, allocations " << pool.allocations << ", fragmentation "
+              << pool.fragmentation() << std::endl;
+    allocator.deallocate(block, 60U);
+    allocator.deallocate(small, 3U);
+
+    // Allocators inside standard containers record into counters shared by their tag
+    {
+        using Allocator = containers::ReservedPoolAllocator<int, 256, containers::HeapStorage,
+                                                            containers::FreeListRecycling,
+                                                            containers::SharedStats<Orders>>;
+        std::list<int, Allocator> orders;
+        for (int i = 0; i < 100; ++i)
+        {
+            orders.push_back(i);
+        }
+        orders.resize(10U);
+
+        const containers::PoolStatsSnapshot shared = containers::sharedPoolStats<Orders>();
+        std::cout << "Orders: current " << shared.current_bytes << " B, peak " << shared.peak_bytes
+                  << " B, free blocks " << shared.free_blocks << std::endl;
+    }
+
+    // A monitoring thread samples the peak of a buffer while it is being filled
+    containers::CircularBuffer<int, 64, containers::HeapStorage, containers::CollectStats> buffer{
+        containers::OverflowBehaviour::OVERFLOW_OLDEST};
+    std::atomic<bool> done{false};
+    std::thread monitor{[&buffer, &done]() {
+        while (!done.load(std::memory_order_acquire))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        const containers::ContainerStatsSnapshot snapshot = buffer.stats();
+        std::cout << "Buffer: peak " << snapshot.peak_size << ", dropped " << snapshot.dropped << std::endl;
+    }};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        buffer.push(i);
+    }
+    done.store(true, std::memory_order_release);
+    monitor.join();
+
+    // Peak size of a vector, e.g. to right-size its MaxSize
+    containers::GenericVector<int, 128, containers::StackAllocationPolicy, containers::CollectStats> vector;
+    for (int i = 0; i < 40; ++i)
+    {
+        vector.push_back(i);
+    }
+    vector.clear();
+    vector.push_back(1);
+    std::cout << "Vector: size " << vector.size() << ", peak " << vector.stats().peak_size << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "cache_aligned.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Stats
+{
+    std::uint64_t messages;
+    std::uint64_t bytes;
+};
+
+void record(Stats &stats, const std::uint64_t bytes)
+{
+    ++stats.messages;
+    stats.bytes += bytes;
+}
+
+int main()
+{
+    constexpr std::size_t WORKERS = 4U;
+
+    // Each worker's slot lives on its own cache line, so the workers never invalidate each other's lines
+    containers::CacheAlignedStackVector<Stats, WORKERS> stats;
+    for (std::size_t i = 0U; i < WORKERS; ++i)
+    {
+        stats.emplace_back(0U, 0U);
+    }
+
+    std::vector<std::thread> workers;
+    for (std::size_t w = 0U; w < WORKERS; ++w)
+    {
+        workers.emplace_back([&stats, w]() {
+            for (std::uint64_t i = 0U; i < 100'000U; ++i)
+            {
+                // Elements bind to Stats & and expose its members directly
+                record(stats[w], 64U + w);
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::cout << "Slot size: " << sizeof(stats[0]) << " bytes" << std::endl;
+    for (const auto &slot : stats)
+    {
+        std::cout << "messages: " << slot.messages << ", bytes: " << slot.bytes << std::endl;
+    }
+
+    // Non-class elements convert to T & and support the usual counter updates
+    containers::CacheAlignedHeapVector<std::uint64_t, WORKERS> counters;
+    counters.emplace_back(1U);
+    counters[0] += 41U;
+    ++counters[0];
+    std::uint64_t &counter = counters[0];
+    std::cout << "Counter: " << counter << std::endl;
+
+    return 0;
+}
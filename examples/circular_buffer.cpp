@@ -1,6 +1,10 @@
 #include "circular_buffer.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <iostream>
+#include <ranges>
 #include <string>
 
 int main()
@@ -95,5 +99,79 @@ int main()
         std::cout << value << std::endl;
     }
 
+    // Re-queue the oldest element of a full buffer: the new element is built before the oldest one is dropped
+    containers::CircularBuffer<std::string, 2> retries{containers::OverflowBehaviour::OVERFLOW_OLDEST};
+    retries.push(std::string{"first request"});
+    retries.push(std::string{"second request"});
+    retries.push(retries.front());
+    std::cout << "Retries: " << retries.front() << ", " << retries.back() << std::endl;
+
+    // Keep the elements inline in the object instead of on the heap
+    containers::StackCircularBuffer<std::string, 4> buffer_5;
+    buffer_5.emplace("inline");
+    buffer_5.push(std::string{"storage"});
+    std::cout << "Inline buffer: " << buffer_5.front() << " " << buffer_5.back() << std::endl;
+
+    // Bulk operations copy whole regions at once
+    containers::CircularBuffer<int, 8> buffer_4;
+
+    const std::array<int, 6> values{1, 2, 3, 4, 5, 6};
+    buffer_4.push_n(values.data(), values.size());
+
+    std::array<int, 4> popped{};
+    const std::size_t popped_count = buffer_4.try_pop_n(popped.data(), popped.size());
+    std::cout << "Popped " << popped_count << " elements in bulk" << std::endl;
+
+    // Write directly into the free space; the region wraps around the end of the storage
+    const auto write_region = buffer_4.reserve_write(5U);
+    std::memcpy(write_region.first.data(), values.data(), write_region.first.size_bytes());
+    std::memcpy(write_region.second.data(), values.data() + write_region.first.size(),
+                write_region.second.size_bytes());
+    buffer_4.commit_write(write_region.size());
+
+    // Read directly from the storage
+    const auto read_region = buffer_4.peek_read(buffer_4.size());
+    std::cout << "Readable segments: " << read_region.first.size() << " + " << read_region.second.size() << std::endl;
+    for (const int element : read_region.first)
+    {
+        std::cout << element << " ";
+    }
+    for (const int element : read_region.second)
+    {
+        std::cout << element << " ";
+    }
+    std::cout << std::endl;
+    buffer_4.release_read(read_region.size());
+
+    // Iterators visit the elements in order across the wrap-around and work with the standard algorithms and ranges
+    buffer_4.push_n(values.data(), values.size());
+    std::cout << "Elements:";
+    for (const int element : buffer_4)
+    {
+        std::cout << " " << element;
+    }
+    std::cout << ", even: " << std::ranges::count_if(buffer_4, [](const int element) { return element % 2 == 0; })
+              << ", largest: " << *std::ranges::max_element(buffer_4) << ", third: " << buffer_4.begin()[2]
+              << std::endl;
+    std::cout << "Newest first:";
+    for (const int element : buffer_4 | std::views::reverse | std::views::take(3))
+    {
+        std::cout << " " << element;
+    }
+    std::cout << std::endl;
+
+    // Hot loops run over the two contiguous chunks
+    long sum = 0;
+    const auto chunks = buffer_4.segments();
+    for (const int element : chunks.first)
+    {
+        sum += element;
+    }
+    for (const int element : chunks.second)
+    {
+        sum += element;
+    }
+    std::cout << "Sum over segments: " << sum << std::endl;
+
     return 0;
 }
@@ -0,0 +1,77 @@
+#include "concurrent_pool.hpp"
+#include "mpmc_circular_buffer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Message
+{
+    std::uint64_t id;
+    std::uint64_t payload;
+};
+
+int main()
+{
+    static constexpr std::size_t POOL_SIZE = 256;
+    static constexpr std::uint64_t MESSAGES_PER_PRODUCER = 10'000;
+
+    // Messages are allocated by the producers and freed by the consumers, the blocks travel back in batches
+    containers::HeapConcurrentPool<Message, POOL_SIZE, 16> pool;
+    containers::MpmcCircularBuffer<Message *, 64> queue;
+
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> received{0};
+    std::vector<std::thread> threads;
+
+    for (std::uint64_t p = 0; p < 2; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            decltype(pool)::ThreadCache cache{pool};
+            for (std::uint64_t i = 0; i < MESSAGES_PER_PRODUCER; ++i)
+            {
+                Message *message = cache.create(p * MESSAGES_PER_PRODUCER + i, i);
+                while (!queue.try_push(message))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int c = 0; c < 2; ++c)
+    {
+        threads.emplace_back([&]() {
+            decltype(pool)::ThreadCache cache{pool};
+            Message *message;
+            while (received.load() < 2 * MESSAGES_PER_PRODUCER)
+            {
+                if (queue.try_pop(message))
+                {
+                    sum += message->payload;
+                    cache.destroy(message);
+                    ++received;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    // 20000 messages went through a pool of 256 blocks
+    std::cout << "Received " << received.load() << " messages through a pool of " << POOL_SIZE << " blocks"
+              << std::endl;
+    std::cout << "Sum of payloads: " << sum.load() << " (expected "
+              << 2 * (MESSAGES_PER_PRODUCER * (MESSAGES_PER_PRODUCER - 1) / 2) << ")" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+int main()
+{
+    // Keys and values are kept in separate inline arrays
+    containers::StackFlatMap<std::string, double, 16> prices;
+
+    // Inserting elements keeps the keys sorted
+    prices.try_emplace("MSFT", 410.5);
+    prices.insert({"AAPL", 189.2});
+    prices["GOOG"] = 141.8;
+
+    // Bulk insertion sorts and merges once
+    const std::array<std::pair<std::string, double>, 3> updates{
+        {{"NVDA", 880.1}, {"AMZN", 178.3}, {"AAPL", 0.0}}};
+    prices.insert_range(updates.begin(), updates.end());
+
+    std::cout << "Prices: ";
+    for (const auto [symbol, price] : prices)
+    {
+        std::cout << symbol << "=" << price << " ";
+    }
+    std::cout << std::endl;
+
+    // Heterogeneous lookup does not construct a std::string
+    constexpr std::string_view symbol{"NVDA"};
+    if (prices.contains(symbol))
+    {
+        std::cout << "NVDA: " << prices.at(symbol) << std::endl;
+    }
+
+    // The sorted keys are contiguous
+    std::cout << "First key: " << prices.keys().front() << ", number of keys: " << prices.keys().size() << std::endl;
+
+    prices.erase("MSFT");
+    std::cout << "Contains MSFT after erase: " << std::boolalpha << prices.contains("MSFT") << std::endl;
+
+    // Sets store only the sorted keys
+    containers::StackFlatSet<int, 8> ids;
+    const std::array<int, 6> new_ids{5, 3, 9, 3, 1, 5};
+    ids.insert_range(new_ids.begin(), new_ids.end());
+    ids.insert(4);
+
+    std::cout << "Ids: ";
+    for (const int id : ids)
+    {
+        std::cout << id << " ";
+    }
+    std::cout << std::endl;
+
+    try
+    {
+        const std::array<int, 4> too_many_ids{10, 11, 12, 13};
+        ids.insert_range(too_many_ids.begin(), too_many_ids.end());
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cout << "Exception: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
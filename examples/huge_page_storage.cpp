@@ -0,0 +1,81 @@
+#include "generic_vector.hpp"
+#include "huge_page_storage.hpp"
+#include "reserved_pool_allocator.hpp"
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const char *toString(const containers::PageBacking backing)
+{
+    switch (backing)
+    {
+    case containers::PageBacking::EXPLICIT_HUGE_PAGES:
+        return "explicit huge pages";
+    case containers::PageBacking::TRANSPARENT_HUGE_PAGES:
+        return "transparent huge pages";
+    default:
+        return "regular pages";
+    }
+}
+
+// Fills a pool-backed vector and returns the time spent, which includes page faults on first touch
+template <template <typename, std::size_t> class StoragePolicy> long long fillMicroseconds()
+{
+    static constexpr std::size_t MAX_SIZE = 1000'000;
+
+    std::vector<double, containers::ReservedPoolAllocator<double, MAX_SIZE, StoragePolicy>> vector;
+    vector.reserve(MAX_SIZE);
+
+    const auto t1 = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+    {
+        vector.push_back(static_cast<double>(i));
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+}
+} // namespace
+
+int main()
+{
+    try
+    {
+        containers::HugePageStorage<double, 1000'000> storage;
+        std::cout << "HugePageStorage of " << storage.bytes() << " bytes backed by " << toString(storage.backing())
+                  << std::endl;
+
+        containers::LockedHugePageStorage<double, 1000'000> locked_storage;
+        std::cout << "LockedHugePageStorage backed by " << toString(locked_storage.backing()) << ", "
+                  << (locked_storage.locked() ? "locked" : "not locked (RLIMIT_MEMLOCK too low?)") << std::endl;
+
+        std::cout << "Filling pool with HeapStorage [microsec]: " << fillMicroseconds<containers::HeapStorage>()
+                  << std::endl;
+        std::cout << "Filling pool with HugePageStorage [microsec]: "
+                  << fillMicroseconds<containers::HugePageStorage>() << std::endl;
+
+        // GenericVector takes the same storage through an allocation policy
+        containers::GenericVector<int, 1024, containers::HugePageAllocationPolicy> vector;
+        for (int i = 0; i < 10; ++i)
+        {
+            vector.push_back(i);
+        }
+
+        for (const auto &value : vector)
+        {
+            std::cout << value << " ";
+        }
+        std::cout << std::endl;
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
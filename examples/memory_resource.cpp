@@ -0,0 +1,61 @@
+#include "memory_resource.hpp"
+
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Non-templated API, the containers do not carry the allocator in their type
+std::size_t countWords(const std::pmr::vector<std::pmr::string> &words,
+                       std::pmr::unordered_map<std::pmr::string, int> &counts)
+{
+    for (const auto &word : words)
+    {
+        ++counts[word];
+    }
+    return counts.size();
+}
+
+int main()
+{
+    // One pre-reserved arena per request, reset in O(1) after the request is done
+    containers::StackMonotonicResource<16 * 1024> arena;
+
+    for (int request = 0; request < 3; ++request)
+    {
+        {
+            std::pmr::vector<std::pmr::string> words{&arena};
+            std::pmr::unordered_map<std::pmr::string, int> counts{&arena};
+
+            for (const char *word : {"ring", "buffer", "ring", "pool", "arena with a reasonably long name", "pool"})
+            {
+                words.emplace_back(word);
+            }
+
+            std::cout << "Request " << request << ": " << countWords(words, counts) << " distinct words, "
+                      << arena.used() << " bytes used" << std::endl;
+        }
+
+        arena.release();
+    }
+
+    // The pooled resource reuses freed blocks, so a long-lived container that grows and shrinks stays within bounds
+    containers::HeapPooledResource<64 * 1024> pool;
+    std::pmr::vector<int> numbers{&pool};
+
+    for (int round = 0; round < 100; ++round)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            numbers.push_back(i);
+        }
+        numbers.clear();
+        numbers.shrink_to_fit();
+    }
+
+    std::cout << "Pooled resource used " << pool.used() << " of " << pool.capacity() << " bytes after 100 rounds"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "circular_buffer.hpp"
+#include "mirrored_storage.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+int main()
+{
+    // The storage size must be a multiple of the page size for the mirror to be active
+    containers::CircularBuffer<std::byte, 4096, containers::MirroredStorage> buffer;
+
+    std::cout << "Mirrored storage: " << std::boolalpha << buffer.mirrored() << std::endl;
+
+    // Move the read position close to the end of the storage
+    const std::byte padding[4090]{};
+    buffer.push_n(padding, sizeof(padding));
+    buffer.release_read(sizeof(padding));
+
+    // This message wraps around the end of the storage
+    constexpr std::string_view message{"wrapped message"};
+    const auto write_region = buffer.reserve_write(message.size());
+    std::memcpy(write_region.first.data(), message.data(), write_region.first.size());
+    std::memcpy(write_region.second.data(), message.data() + write_region.first.size(), write_region.second.size());
+    buffer.commit_write(message.size());
+
+    // With the mirror active the whole message is readable in place as a single span
+    const auto read_region = buffer.peek_read(message.size());
+    std::cout << "Readable segments: " << read_region.first.size() << " + " << read_region.second.size() << std::endl;
+
+    if (read_region.second.empty())
+    {
+        std::cout << "Message: "
+                  << std::string_view{static_cast<const char *>(static_cast<const void *>(read_region.first.data())),
+                                      read_region.first.size()}
+                  << std::endl;
+    }
+
+    buffer.release_read(read_region.size());
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "mpmc_circular_buffer.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    containers::MpmcCircularBuffer<int, 16> buffer;
+
+    std::atomic<int> sum{0};
+    std::atomic<int> received{0};
+    std::vector<std::thread> threads;
+
+    // Two producers and two consumers share the buffer
+    for (int p = 0; p < 2; ++p)
+    {
+        threads.emplace_back([&buffer, p]() {
+            for (int i = 0; i < 100; ++i)
+            {
+                while (!buffer.try_push(p * 100 + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int c = 0; c < 2; ++c)
+    {
+        threads.emplace_back([&]() {
+            int value;
+            while (received.load() < 200)
+            {
+                if (buffer.try_pop(value))
+                {
+                    sum += value;
+                    ++received;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::cout << "Sum of received values: " << sum.load() << std::endl;
+
+    // Overflow behaviour matches CircularBuffer
+    containers::MpmcCircularBuffer<int, 4> buffer_2{containers::OverflowBehaviour::OVERFLOW_OLDEST};
+
+    for (int i = 0; i < 6; ++i)
+    {
+        buffer_2.push(i);
+    }
+
+    // Prints 2 3 4 5
+    int value;
+    while (buffer_2.try_pop(value))
+    {
+        std::cout << value << std::endl;
+    }
+
+    containers::MpmcCircularBuffer<int, 2> buffer_3;
+    buffer_3.push(1);
+    buffer_3.push(2);
+
+    try
+    {
+        buffer_3.push(3);
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cout << "Exception: " << e.what() << std::endl;
+    }
+
+    std::cout << "Popped: " << buffer_3.pop() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "generic_vector.hpp"
+#include "numa_storage.hpp"
+#include "reserved_pool_allocator.hpp"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    std::cout << "Online NUMA nodes: " << containers::numa::nodeCount() << std::endl;
+
+    // Storage for a pinned worker is constructed on the worker, so binding and prefaulting happen on its node
+    std::thread worker([]() {
+        std::vector<double, containers::ReservedPoolAllocator<double, 100'000, containers::NumaLocalStorage>> pool;
+        pool.reserve(100'000);
+        pool.push_back(1.0);
+
+        containers::NumaLocalStorage<int, 1024> storage;
+        std::cout << "Worker on node " << containers::numa::currentNode() << ", storage bound to node "
+                  << storage.node() << (storage.bound() ? "" : " (binding not supported)") << std::endl;
+    });
+    worker.join();
+
+    // A vector built by the main thread and handed to a worker moves its pages to the worker's node
+    containers::GenericVector<int, 1024, containers::NumaLocalAllocationPolicy> vector;
+    for (int i = 0; i < 10; ++i)
+    {
+        vector.push_back(i);
+    }
+
+    std::thread consumer([&vector]() {
+        vector.bindToCallingThread();
+        int sum = 0;
+        for (const auto value : vector)
+        {
+            sum += value;
+        }
+        std::cout << "Vector moved to node " << vector.numaNode() << ", sum " << sum << std::endl;
+    });
+    consumer.join();
+
+    // Interleaved placement spreads the bandwidth of shared read-mostly data over all nodes
+    containers::GenericVector<int, 1024, containers::NumaInterleavedAllocationPolicy> shared;
+    shared.push_back(42);
+    std::cout << "Interleaved vector holds " << shared[0] << std::endl;
+
+    return 0;
+}
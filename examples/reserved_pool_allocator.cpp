@@ -4,6 +4,8 @@
 #include <cmath>
 #include <exception>
 #include <iostream>
+#include <list>
+#include <new>
 #include <vector>
 
 int main()
@@ -110,6 +112,56 @@ int main()
         return 2;
     }
 
+    try
+    {
+        // A list allocates and frees one node per element. Without recycling the pool runs out after MAX_NODES
+        // insertions, with FreeListRecycling the freed nodes are handed out again.
+        static constexpr std::size_t MAX_NODES = 64;
+
+        std::list<int, containers::ReservedPoolAllocator<int, MAX_NODES, containers::StackStorage,
+                                                         containers::FreeListRecycling>>
+            recycling_list;
+
+        for (int round = 0; round < 1000; ++round)
+        {
+            for (int i = 0; i < 32; ++i)
+            {
+                recycling_list.push_back(i);
+            }
+            recycling_list.clear();
+        }
+
+        std::cout << std::endl << "Recycling list survived 32000 insertions into a pool of " << MAX_NODES << " nodes"
+                  << std::endl;
+
+        std::list<int, containers::ReservedPoolAllocator<int, MAX_NODES, containers::StackStorage>> monotonic_list;
+        try
+        {
+            for (int round = 0; round < 1000; ++round)
+            {
+                for (int i = 0; i < 32; ++i)
+                {
+                    monotonic_list.push_back(i);
+                }
+                monotonic_list.clear();
+            }
+        }
+        catch (const std::bad_alloc &)
+        {
+            std::cout << "Monotonic list ran out of memory as expected" << std::endl;
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception!" << std::endl;
+        return 2;
+    }
+
     try
     {
         static constexpr std::size_t MAX_SIZE = 1000'000;
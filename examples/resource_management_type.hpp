@@ -14,7 +14,11 @@ class ResourceManagingType
 
     ~ResourceManagingType()
     {
-        std::cout << "Destroying: " << data_ << std::endl;
+        // Moved-from objects no longer own any data
+        if (nullptr != data_)
+        {
+            std::cout << "Destroying: " << data_ << std::endl;
+        }
         delete[] data_;
         data_ = nullptr;
     }
@@ -0,0 +1,67 @@
+#include "sliding_window.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+// OHLC bar of the ticks in the window: associative but not commutative, so the older side must stay on the left
+struct Bar
+{
+    double open;
+    double high;
+    double low;
+    double close;
+    bool valid;
+};
+
+struct BarMonoid
+{
+    using value_type = Bar;
+
+    static Bar identity()
+    {
+        return Bar{0.0, 0.0, 0.0, 0.0, false};
+    }
+
+    static Bar combine(const Bar &older, const Bar &newer)
+    {
+        if (!older.valid)
+        {
+            return newer;
+        }
+        if (!newer.valid)
+        {
+            return older;
+        }
+        return Bar{older.open, std::max(older.high, newer.high), std::min(older.low, newer.low), newer.close, true};
+    }
+
+    static Bar lift(const double price)
+    {
+        return Bar{price, price, price, price, true};
+    }
+};
+
+int main()
+{
+    const double prices[] = {100.0, 100.5, 101.25, 100.75, 99.5, 99.75, 100.25, 101.0, 102.0, 101.5};
+    const double volumes[] = {10.0, 5.0, 20.0, 15.0, 30.0, 10.0, 5.0, 25.0, 40.0, 10.0};
+
+    // The last 4 prices, older prices are evicted as new ones arrive
+    containers::RollingStatistics<double, 4, containers::StackStorage> statistics;
+    containers::RollingVwap<double, 4, containers::StackStorage> vwap;
+    containers::WindowAggregator<double, 4, BarMonoid, containers::StackStorage> bars;
+
+    for (std::size_t i = 0U; i < std::size(prices); ++i)
+    {
+        statistics.push(prices[i]);
+        vwap.push(prices[i], volumes[i]);
+        bars.push(prices[i]);
+
+        const Bar bar = bars.query();
+        std::cout << "price " << prices[i] << ": mean " << statistics.mean() << ", stddev " << statistics.stddev()
+                  << ", min " << statistics.min() << ", max " << statistics.max() << ", vwap " << vwap.vwap()
+                  << ", bar " << bar.open << "/" << bar.high << "/" << bar.low << "/" << bar.close << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "slot_map.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+struct Order
+{
+    std::string symbol;
+    double price;
+    int quantity;
+};
+
+int main()
+{
+    // Orders referenced by handle instead of by a hashed ID, stored inline
+    containers::StackSlotMap<Order, 256> orders;
+
+    const auto buy = orders.insert(Order{"AAPL", 189.2, 100});
+    const auto sell = orders.emplace("MSFT", 410.5, -50);
+    orders.insert(Order{"NVDA", 880.1, 10});
+
+    // One bounds check and one generation compare
+    if (auto *order = orders.find(buy))
+    {
+        order->quantity += 50;
+    }
+
+    // Handles can be stored as plain integers and restored later
+    const std::uint64_t id = sell.value();
+    std::cout << "Order " << id << ": " << orders[decltype(sell){id}].symbol << std::endl;
+
+    // Erasing bumps the slot's generation, so the old handle goes stale even after the slot is reused
+    orders.erase(sell);
+    const auto replacement = orders.insert(Order{"GOOG", 141.8, 20});
+    std::cout << "Stale handle resolves: " << std::boolalpha << orders.contains(sell)
+              << ", replacement resolves: " << orders.contains(replacement) << std::endl;
+
+    // Live orders are packed densely
+    for (const Order &order : orders)
+    {
+        std::cout << order.symbol << " " << order.quantity << " @ " << order.price << std::endl;
+    }
+
+    // 32-bit handles for tables that embed many references
+    containers::HeapSlotMap<int, 1024, std::uint32_t> small_handles;
+    const auto handle = small_handles.insert(42);
+    std::cout << "Handle size: " << sizeof(handle) << " bytes, value: " << small_handles.at(handle) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include "small_vector.hpp"
+
+#include <iostream>
+#include <string>
+
+int main()
+{
+    // Field lists of most messages fit into the inline storage, so no allocation happens
+    containers::SmallVector<std::string, 8> fields;
+    for (const char *field : {"symbol", "price", "quantity", "side"})
+    {
+        fields.push_back(field);
+    }
+
+    std::cout << "Fields: " << fields.size() << ", capacity: " << fields.capacity()
+              << ", inline: " << (fields.isInline() ? "yes" : "no") << std::endl;
+
+    // Larger lists spill to the heap with geometric growth
+    for (int i = 0; i < 20; ++i)
+    {
+        fields.emplace_back("extra_" + std::to_string(i));
+    }
+
+    std::cout << "Fields: " << fields.size() << ", capacity: " << fields.capacity()
+              << ", inline: " << (fields.isInline() ? "yes" : "no") << std::endl;
+
+    // Once the list is small again, shrink_to_fit moves it back inline and frees the heap buffer
+    fields.resize(3);
+    fields.shrink_to_fit();
+
+    std::cout << "Fields: " << fields.size() << ", capacity: " << fields.capacity()
+              << ", inline: " << (fields.isInline() ? "yes" : "no") << std::endl;
+
+    for (const auto &field : fields)
+    {
+        std::cout << field << " ";
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "soa_vector.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <tuple>
+
+int main()
+{
+    // Columns: price, quantity, side (+1 buy, -1 sell)
+    containers::HeapSoAVector<1024, double, std::int64_t, std::int8_t> orders;
+
+    orders.push_back({100.25, 10, 1});
+    orders.push_back({100.50, 5, -1});
+    orders.emplace_back(99.75, std::int64_t{20}, std::int8_t{1});
+
+    // A pass over one field only touches that column
+    const auto prices = orders.column<0>();
+    std::cout << "Average price: " << std::accumulate(prices.begin(), prices.end(), 0.0) / prices.size()
+              << std::endl;
+
+    // Elements are proxies of references, so structured bindings modify the columns
+    for (auto [price, quantity, side] : orders)
+    {
+        if (side > 0)
+        {
+            quantity *= 2;
+        }
+    }
+
+    for (std::size_t i = 0; i < orders.size(); ++i)
+    {
+        const auto [price, quantity, side] = orders[i];
+        std::cout << price << " x " << quantity << (side > 0 ? " buy" : " sell") << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "spsc_circular_buffer.hpp"
+
+#include <iostream>
+#include <thread>
+
+int main()
+{
+    containers::SpscCircularBuffer<int, 8> buffer;
+
+    // The producer thread fills the buffer while the main thread consumes it
+    std::thread producer{[&buffer]() {
+        for (int i = 0; i < 20; ++i)
+        {
+            while (!buffer.try_push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    int value;
+    for (int received = 0; received < 20;)
+    {
+        if (buffer.try_pop(value))
+        {
+            std::cout << value << std::endl;
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    // Single-threaded use is also valid
+    for (int i = 0; i < 10; ++i)
+    {
+        if (!buffer.try_emplace(i))
+        {
+            std::cout << "Buffer is full. Could not emplace: " << i << std::endl;
+        }
+    }
+
+    std::cout << "Buffer size: " << buffer.size() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include "static_deque.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+
+struct Trade
+{
+    std::uint64_t timestamp;
+    double price;
+};
+
+int main()
+{
+    // Time window of the last trades: new trades at the back, expired ones leave at the front
+    containers::StackDeque<Trade, 8> window;
+    for (std::uint64_t t = 0U; t < 12U; ++t)
+    {
+        window.push_back(Trade{t * 10U, 100.0 + static_cast<double>(t)});
+        while (window.back().timestamp - window.front().timestamp > 40U)
+        {
+            window.pop_front();
+        }
+    }
+
+    const double sum = std::accumulate(window.begin(), window.end(), 0.0,
+                                       [](const double total, const Trade &trade) { return total + trade.price; });
+    std::cout << "Trades in window: " << window.size() << ", average price: " << (sum / window.size()) << std::endl;
+
+    // Depth levels: a better level is pushed at the front
+    containers::HeapDeque<double, 16> bids;
+    bids.push_back(99.5);
+    bids.push_back(99.0);
+    bids.push_front(99.75);
+    bids.emplace_front(100.0);
+
+    std::cout << "Bids:";
+    for (const double bid : bids)
+    {
+        std::cout << " " << bid;
+    }
+    std::cout << ", second level: " << bids[1] << std::endl;
+
+    // Iterators are random access across the wrap-around
+    bids.pop_back();
+    std::reverse(bids.begin(), bids.end());
+    std::cout << "Reversed:";
+    for (auto it = bids.cbegin(); it != bids.cend(); ++it)
+    {
+        std::cout << " " << *it;
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
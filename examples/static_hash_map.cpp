@@ -0,0 +1,63 @@
+#include "static_hash_map.hpp"
+
+#include <iostream>
+#include <string>
+
+int main()
+{
+    // Slots are kept inline in the object
+    containers::StackHashMap<int, std::string, 8> stack_map;
+
+    // Inserting elements
+    stack_map.try_emplace(1, "one");
+    stack_map.insert({2, "two"});
+    stack_map[3] = "three";
+
+    // Inserting an existing key keeps the old value
+    if (!stack_map.try_emplace(1, "uno").second)
+    {
+        std::cout << "Key 1 already present: " << stack_map.at(1) << std::endl;
+    }
+
+    stack_map.insert_or_assign(1, "uno");
+    std::cout << "Key 1 after insert_or_assign: " << stack_map.at(1) << std::endl;
+
+    // Iteration order is unspecified
+    std::cout << "Elements: ";
+    for (const auto &[key, value] : stack_map)
+    {
+        std::cout << key << "=" << value << " ";
+    }
+    std::cout << std::endl;
+
+    // Erasing elements
+    stack_map.erase(2);
+    std::cout << "Contains 2 after erase: " << std::boolalpha << stack_map.contains(2) << std::endl;
+
+    // Slots are allocated on the heap once, at construction
+    containers::HeapHashMap<int, int, 4> heap_map;
+    for (int i = 0; i < 4; ++i)
+    {
+        heap_map[i] = i * i;
+    }
+
+    try
+    {
+        heap_map[4] = 16;
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cout << "Exception: " << e.what() << std::endl;
+    }
+
+    try
+    {
+        std::cout << heap_map.at(10) << std::endl;
+    }
+    catch (const std::out_of_range &e)
+    {
+        std::cout << "Exception: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
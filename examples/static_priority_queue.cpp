@@ -0,0 +1,57 @@
+#include "static_priority_queue.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+
+struct Timer
+{
+    std::uint64_t deadline;
+    int id;
+
+    bool operator>(const Timer &other) const noexcept
+    {
+        return (deadline > other.deadline);
+    }
+};
+
+int main()
+{
+    // Max-heap of order priorities kept inline, the top is the largest value
+    containers::StackPriorityQueue<int, 16> priorities;
+
+    // Bulk insertion builds the heap bottom-up in linear time
+    const std::array<int, 6> initial{3, 9, 1, 7, 5, 8};
+    priorities.push_range(initial.begin(), initial.end());
+    priorities.push(6);
+
+    std::cout << "Priorities: ";
+    while (!priorities.empty())
+    {
+        std::cout << priorities.pop() << " ";
+    }
+    std::cout << std::endl;
+
+    // Min-heap of timers with handles, so pending timers can be rescheduled or cancelled
+    containers::StaticPriorityQueue<Timer, 64, std::greater<>, containers::HeapAllocationPolicy, 4U,
+                                    containers::TrackedHandles>
+        timers;
+
+    const auto heartbeat = timers.push(Timer{100U, 1});
+    const auto retry = timers.push(Timer{250U, 2});
+    timers.push(Timer{400U, 3});
+
+    // Bring the retry forward, then cancel the heartbeat
+    timers.decrease_key(retry, Timer{50U, 2});
+    std::cout << "Retry now fires at " << timers.get(retry).deadline << std::endl;
+    timers.erase(heartbeat);
+
+    while (!timers.empty())
+    {
+        const Timer timer = timers.pop();
+        std::cout << "Timer " << timer.id << " fires at " << timer.deadline << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "mpmc_circular_buffer.hpp"
+#include "spsc_circular_buffer.hpp"
+#include "waiting_buffer.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+int main()
+{
+    // The consumer parks in the kernel while the buffer is empty instead of spinning on try_pop()
+    containers::WaitingBuffer<containers::SpscCircularBuffer<int, 64>, containers::ParkingWait<>> orders;
+
+    std::thread producer{[&orders]() {
+        for (int i = 0; i < 5; ++i)
+        {
+            std::this_thread::sleep_for(10ms);
+            orders.try_push(i);
+        }
+
+        // A batch wakes the consumer once
+        const int batch[] = {100, 101, 102, 103};
+        orders.try_push_n(batch, 4U);
+    }};
+
+    for (int i = 0; i < 5; ++i)
+    {
+        std::cout << "Order " << orders.pop() << std::endl;
+    }
+
+    int received[8];
+    std::size_t total = 0U;
+    while (total < 4U)
+    {
+        const std::size_t count = orders.pop_n_for(received, 8U, 1s);
+        std::cout << "Batch of " << count << std::endl;
+        total += count;
+    }
+    producer.join();
+
+    // Give up after a timeout when nothing arrives
+    int value;
+    if (!orders.pop_for(value, 5ms))
+    {
+        std::cout << "No order within 5 ms" << std::endl;
+    }
+
+    // The strategy is a template parameter, the buffer is unchanged: spin first, then yield the core
+    containers::WaitingBuffer<containers::MpmcCircularBuffer<int, 64>, containers::SpinYieldWait<1024U>> jobs;
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 2; ++w)
+    {
+        workers.emplace_back([&jobs]() {
+            int job;
+            while (jobs.pop_for(job, 20ms))
+            {
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        while (!jobs.try_push(i))
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    std::cout << "Jobs left: " << jobs.size() << std::endl;
+
+    return 0;
+}
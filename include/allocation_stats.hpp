@@ -0,0 +1,408 @@
+#ifndef CONTAINERS_ALLOCATION_STATS_HPP
+#define CONTAINERS_ALLOCATION_STATS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace containers
+{
+// Stats policies for ReservedPoolAllocator, GenericVector and CircularBuffer, used to size capacities from telemetry.
+// All counters are atomics, so a monitoring thread can take snapshots at any time without locking; the fields of a
+// snapshot are read one by one and may be a few operations apart.
+
+// Records nothing, every hook compiles away (the default)
+struct NoStats
+{
+};
+
+// Every object records into its own counters, read through its stats() member
+struct CollectStats
+{
+};
+
+// All objects with the same Tag record into one process-wide set of counters, read through sharedPoolStats<Tag>() or
+// sharedContainerStats<Tag>(). Needed for allocators inside standard containers, which keep (and rebind) their
+// allocator out of reach. Peaks are then taken over all objects of the tag.
+template <typename Tag> struct SharedStats
+{
+};
+
+// Bucket k of the request histogram counts requests of (2^(k-1), 2^k] bytes, the last bucket everything larger
+inline constexpr std::size_t STATS_HISTOGRAM_BUCKETS = 32U;
+
+struct PoolStatsSnapshot
+{
+    std::uint64_t current_bytes;      // Bytes in live allocations, as requested
+    std::uint64_t peak_bytes;         // High-water mark of current_bytes
+    std::uint64_t reserved_bytes;     // Bytes taken from the pools by their bump pointers
+    std::uint64_t peak_pool_bytes;    // Largest bump pointer of a single pool, the MaxSize that would have sufficed
+    std::uint64_t free_blocks;        // Recycled blocks waiting on free lists
+    std::uint64_t allocations;        // Successful allocate() calls
+    std::uint64_t deallocations;      // deallocate() calls
+    std::uint64_t failed_allocations; // allocate() calls that threw bad_alloc
+    std::array<std::uint64_t, STATS_HISTOGRAM_BUCKETS> request_histogram;
+
+    // Share of the reserved memory that holds no live allocation: blocks on free lists, the unused tail of recycled
+    // blocks and, without recycling, everything that was freed
+    inline double fragmentation() const noexcept
+    {
+        return (reserved_bytes == 0U) ? 0.0
+                                      : (static_cast<double>(reserved_bytes - std::min(current_bytes, reserved_bytes)) /
+                                         static_cast<double>(reserved_bytes));
+    }
+};
+
+struct ContainerStatsSnapshot
+{
+    std::uint64_t peak_size; // Largest number of elements held at once
+    std::uint64_t dropped;   // Elements overwritten or discarded by OVERFLOW_OLDEST (CircularBuffer only)
+};
+
+namespace detail
+{
+inline constexpr std::size_t histogramBucket(const std::size_t bytes) noexcept
+{
+    const std::size_t bucket = (bytes <= 1U) ? 0U : static_cast<std::size_t>(std::bit_width(bytes - 1U));
+    return (bucket < STATS_HISTOGRAM_BUCKETS) ? bucket : (STATS_HISTOGRAM_BUCKETS - 1U);
+}
+
+// Written by the owning object only, or by many objects when Shared; readable from any thread. The single writer
+// case avoids locked read-modify-write instructions.
+template <bool Shared> class StatCounter
+{
+  public:
+    // Returns the new value
+    inline std::uint64_t add(const std::uint64_t n) noexcept
+    {
+        if constexpr (Shared)
+        {
+            return value_.fetch_add(n, std::memory_order_relaxed) + n;
+        }
+        else
+        {
+            const std::uint64_t updated = value_.load(std::memory_order_relaxed) + n;
+            value_.store(updated, std::memory_order_relaxed);
+            return updated;
+        }
+    }
+
+    inline void subtract(const std::uint64_t n) noexcept
+    {
+        if constexpr (Shared)
+        {
+            value_.fetch_sub(n, std::memory_order_relaxed);
+        }
+        else
+        {
+            value_.store(value_.load(std::memory_order_relaxed) - n, std::memory_order_relaxed);
+        }
+    }
+
+    inline void raise(const std::uint64_t candidate) noexcept
+    {
+        std::uint64_t current = value_.load(std::memory_order_relaxed);
+        if constexpr (Shared)
+        {
+            while ((candidate > current) &&
+                   !value_.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+            {
+            }
+        }
+        else if (candidate > current)
+        {
+            value_.store(candidate, std::memory_order_relaxed);
+        }
+    }
+
+    inline std::uint64_t load() const noexcept
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<std::uint64_t> value_{0U};
+};
+
+template <bool Shared> struct PoolCounters
+{
+    PoolStatsSnapshot snapshot() const noexcept
+    {
+        PoolStatsSnapshot result{};
+        result.current_bytes = current_bytes.load();
+        result.peak_bytes = peak_bytes.load();
+        result.reserved_bytes = reserved_bytes.load();
+        result.peak_pool_bytes = peak_pool_bytes.load();
+        result.free_blocks = free_blocks.load();
+        result.allocations = allocations.load();
+        result.deallocations = deallocations.load();
+        result.failed_allocations = failed_allocations.load();
+        for (std::size_t i = 0U; i < STATS_HISTOGRAM_BUCKETS; ++i)
+        {
+            result.request_histogram[i] = request_histogram[i].load();
+        }
+        return result;
+    }
+
+    StatCounter<Shared> current_bytes;
+    StatCounter<Shared> peak_bytes;
+    StatCounter<Shared> reserved_bytes;
+    StatCounter<Shared> peak_pool_bytes;
+    StatCounter<Shared> free_blocks;
+    StatCounter<Shared> allocations;
+    StatCounter<Shared> deallocations;
+    StatCounter<Shared> failed_allocations;
+    std::array<StatCounter<Shared>, STATS_HISTOGRAM_BUCKETS> request_histogram;
+};
+
+template <bool Shared> struct ContainerCounters
+{
+    ContainerStatsSnapshot snapshot() const noexcept
+    {
+        return ContainerStatsSnapshot{peak_size.load(), dropped.load()};
+    }
+
+    StatCounter<Shared> peak_size;
+    StatCounter<Shared> dropped;
+};
+
+template <typename Policy> inline PoolCounters<true> &sharedPoolCounters() noexcept
+{
+    static PoolCounters<true> counters;
+    return counters;
+}
+
+template <typename Policy> inline ContainerCounters<true> &sharedContainerCounters() noexcept
+{
+    static ContainerCounters<true> counters;
+    return counters;
+}
+
+template <typename StatsPolicy> struct IsSharedStats : std::false_type
+{
+};
+
+template <typename Tag> struct IsSharedStats<SharedStats<Tag>> : std::true_type
+{
+};
+
+struct NoCounters
+{
+};
+
+// Counters owned by the recorder with CollectStats, nothing otherwise. Copies start with fresh counters, the stats
+// belong to the object and not to its contents.
+template <typename StatsPolicy, typename Counters> class StatsRecorderBase
+{
+  public:
+    static constexpr bool ENABLED = !std::is_same_v<StatsPolicy, NoStats>;
+    static constexpr bool SHARED = IsSharedStats<StatsPolicy>::value;
+
+    static_assert(!ENABLED || SHARED || std::is_same_v<StatsPolicy, CollectStats>,
+                  "StatsPolicy must be NoStats, CollectStats or SharedStats<Tag>");
+
+    StatsRecorderBase() noexcept = default;
+
+    StatsRecorderBase(const StatsRecorderBase &) noexcept
+    {
+    }
+
+    StatsRecorderBase &operator=(const StatsRecorderBase &) noexcept
+    {
+        return *this;
+    }
+
+  protected:
+    [[no_unique_address]] std::conditional_t<ENABLED && !SHARED, Counters, NoCounters> local_;
+};
+} // namespace detail
+
+// Hooks called by ReservedPoolAllocator
+template <typename StatsPolicy>
+class PoolStatsRecorder : public detail::StatsRecorderBase<StatsPolicy, detail::PoolCounters<false>>
+{
+    using Base = detail::StatsRecorderBase<StatsPolicy, detail::PoolCounters<false>>;
+
+  public:
+    using Base::ENABLED;
+    using Base::SHARED;
+
+    inline void onAllocate(const std::size_t bytes) noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            auto &c = counters();
+            c.allocations.add(1U);
+            c.request_histogram[detail::histogramBucket(bytes)].add(1U);
+            c.peak_bytes.raise(c.current_bytes.add(bytes));
+        }
+    }
+
+    inline void onDeallocate(const std::size_t bytes) noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            auto &c = counters();
+            c.deallocations.add(1U);
+            c.current_bytes.subtract(bytes);
+        }
+    }
+
+    inline void onFailure(const std::size_t bytes) noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            auto &c = counters();
+            c.failed_allocations.add(1U);
+            c.request_histogram[detail::histogramBucket(bytes)].add(1U);
+        }
+    }
+
+    // pool_bytes is the pool's bump pointer after the bump
+    inline void onBump(const std::size_t bytes, const std::size_t pool_bytes) noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            auto &c = counters();
+            c.reserved_bytes.add(bytes);
+            c.peak_pool_bytes.raise(pool_bytes);
+        }
+    }
+
+    inline void onFreeListPush() noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            counters().free_blocks.add(1U);
+        }
+    }
+
+    inline void onFreeListPop() noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            counters().free_blocks.subtract(1U);
+        }
+    }
+
+    // A pool is destroyed; shared counters give back its memory so they keep describing the live pools
+    inline void onRelease(const std::size_t pool_bytes, const std::size_t free_blocks) noexcept
+    {
+        if constexpr (ENABLED && SHARED)
+        {
+            auto &c = counters();
+            c.reserved_bytes.subtract(pool_bytes);
+            c.free_blocks.subtract(free_blocks);
+        }
+    }
+
+    PoolStatsSnapshot snapshot() const noexcept
+        requires ENABLED
+    {
+        return counters().snapshot();
+    }
+
+  private:
+    inline auto &counters() noexcept
+    {
+        if constexpr (SHARED)
+        {
+            return detail::sharedPoolCounters<StatsPolicy>();
+        }
+        else
+        {
+            return this->local_;
+        }
+    }
+
+    inline const auto &counters() const noexcept
+    {
+        if constexpr (SHARED)
+        {
+            return detail::sharedPoolCounters<StatsPolicy>();
+        }
+        else
+        {
+            return this->local_;
+        }
+    }
+};
+
+// Hooks called by GenericVector and CircularBuffer
+template <typename StatsPolicy>
+class ContainerStatsRecorder : public detail::StatsRecorderBase<StatsPolicy, detail::ContainerCounters<false>>
+{
+    using Base = detail::StatsRecorderBase<StatsPolicy, detail::ContainerCounters<false>>;
+
+  public:
+    using Base::ENABLED;
+    using Base::SHARED;
+
+    // Called after the size grew
+    inline void onSize(const std::size_t size) noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            counters().peak_size.raise(size);
+        }
+    }
+
+    inline void onDrop(const std::size_t count) noexcept
+    {
+        if constexpr (ENABLED)
+        {
+            if (count > 0U)
+            {
+                counters().dropped.add(count);
+            }
+        }
+    }
+
+    ContainerStatsSnapshot snapshot() const noexcept
+        requires ENABLED
+    {
+        return counters().snapshot();
+    }
+
+  private:
+    inline auto &counters() noexcept
+    {
+        if constexpr (SHARED)
+        {
+            return detail::sharedContainerCounters<StatsPolicy>();
+        }
+        else
+        {
+            return this->local_;
+        }
+    }
+
+    inline const auto &counters() const noexcept
+    {
+        if constexpr (SHARED)
+        {
+            return detail::sharedContainerCounters<StatsPolicy>();
+        }
+        else
+        {
+            return this->local_;
+        }
+    }
+};
+
+template <typename Tag> inline PoolStatsSnapshot sharedPoolStats() noexcept
+{
+    return detail::sharedPoolCounters<SharedStats<Tag>>().snapshot();
+}
+
+template <typename Tag> inline ContainerStatsSnapshot sharedContainerStats() noexcept
+{
+    return detail::sharedContainerCounters<SharedStats<Tag>>().snapshot();
+}
+} // namespace containers
+
+#endif // CONTAINERS_ALLOCATION_STATS_HPP
@@ -0,0 +1,134 @@
+#ifndef CONTAINERS_CACHE_ALIGNED_HPP
+#define CONTAINERS_CACHE_ALIGNED_HPP
+
+#include "cache_line.hpp"
+#include "generic_vector.hpp"
+#include "relocation.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Element wrapper that aligns and pads T to whole cache lines, so neighbouring elements of an array never share a
+// line. Used as the element type of a vector holding per-core or per-thread state that is written concurrently.
+// GenericVector computes element addresses from sizeof(T), so the padding has to be part of the element type rather
+// than of the allocation policy.
+//
+// Class types are inherited from, so members are accessed as before (v[cpu].count) and an element binds to T &.
+// Other types are stored as a member and convert implicitly to T &.
+template <typename T> struct CacheAligned;
+
+template <typename T>
+    requires(std::is_class_v<T> && !std::is_final_v<T>)
+struct alignas(CACHE_LINE_SIZE) CacheAligned<T> : T
+{
+    CacheAligned() = default;
+
+    // Initialises T like the allocation policies do, so aggregates can be emplaced field by field
+    template <typename... Args>
+        requires((sizeof...(Args) > 0U) &&
+                 !((sizeof...(Args) == 1U) && (... && std::is_same_v<std::remove_cvref_t<Args>, CacheAligned>)))
+    CacheAligned(Args &&...args) : T{std::forward<Args>(args)...}
+    {
+    }
+
+    using T::operator=;
+
+    inline T &get() noexcept
+    {
+        return *this;
+    }
+
+    inline const T &get() const noexcept
+    {
+        return *this;
+    }
+};
+
+template <typename T>
+    requires(!std::is_class_v<T>)
+struct alignas(CACHE_LINE_SIZE) CacheAligned<T>
+{
+    CacheAligned() = default;
+
+    CacheAligned(const T &value) noexcept(std::is_nothrow_copy_constructible_v<T>) : value{value}
+    {
+    }
+
+    inline CacheAligned &operator=(const T &other) noexcept(std::is_nothrow_copy_assignable_v<T>)
+    {
+        value = other;
+        return *this;
+    }
+
+    inline operator T &() noexcept
+    {
+        return value;
+    }
+
+    inline operator const T &() const noexcept
+    {
+        return value;
+    }
+
+    inline T &get() noexcept
+    {
+        return value;
+    }
+
+    inline const T &get() const noexcept
+    {
+        return value;
+    }
+
+    // Built-in assignment operators do not apply conversions to their left operand, so the usual counter updates are
+    // forwarded explicitly
+    template <typename U> inline CacheAligned &operator+=(const U &other) noexcept
+    {
+        value += other;
+        return *this;
+    }
+
+    template <typename U> inline CacheAligned &operator-=(const U &other) noexcept
+    {
+        value -= other;
+        return *this;
+    }
+
+    inline CacheAligned &operator++() noexcept
+    {
+        ++value;
+        return *this;
+    }
+
+    inline T operator++(int) noexcept
+    {
+        return value++;
+    }
+
+    inline CacheAligned &operator--() noexcept
+    {
+        --value;
+        return *this;
+    }
+
+    inline T operator--(int) noexcept
+    {
+        return value--;
+    }
+
+    T value;
+};
+
+template <typename T> struct is_trivially_relocatable<CacheAligned<T>> : is_trivially_relocatable<T>
+{
+};
+
+// Vectors whose elements each occupy their own cache lines
+template <typename T, std::size_t MaxSize> using CacheAlignedStackVector = StackVector<CacheAligned<T>, MaxSize>;
+template <typename T, std::size_t MaxSize> using CacheAlignedHeapVector = HeapVector<CacheAligned<T>, MaxSize>;
+} // namespace containers
+
+#endif // CONTAINERS_CACHE_ALIGNED_HPP
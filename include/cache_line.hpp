@@ -0,0 +1,13 @@
+#ifndef CONTAINERS_CACHE_LINE_HPP
+#define CONTAINERS_CACHE_LINE_HPP
+
+#include <cstddef>
+
+namespace containers
+{
+// Size used to keep independently written data on separate cache lines. A fixed value is used instead of
+// std::hardware_destructive_interference_size, which is not ABI-stable across compiler flags.
+inline constexpr std::size_t CACHE_LINE_SIZE = 64U;
+} // namespace containers
+
+#endif // CONTAINERS_CACHE_LINE_HPP
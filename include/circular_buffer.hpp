@@ -1,9 +1,20 @@
 #ifndef CONTAINERS_CIRCULAR_BUFFER_HPP
 #define CONTAINERS_CIRCULAR_BUFFER_HPP
 
+#include "allocation_stats.hpp"
+#include "reserved_pool_allocator.hpp"
+#include "ring_iterator.hpp"
+
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <memory>
+#include <new>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace containers
@@ -15,40 +26,144 @@ enum class OverflowBehaviour : std::uint8_t
     OVERFLOW_OLDEST
 };
 
-template <typename T, std::size_t Size> class CircularBuffer
+// A region of a ring buffer split at the wrap-around point. The second span is empty unless the region wraps.
+template <typename T> struct RingSegments
+{
+    std::span<T> first;
+    std::span<T> second;
+
+    inline std::size_t size() const noexcept
+    {
+        return (first.size() + second.size());
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (size() == 0U);
+    }
+};
+
+// StoragePolicy provides uninitialised storage for Size elements through buffer(), e.g. StackStorage to keep the
+// elements inline in the object or HeapStorage to keep them in a single heap allocation. Elements are constructed
+// when pushed and destroyed when popped. Storage that exposes mirrored() (see MirroredStorage) returns every region as
+// a single contiguous span while the mirror is active. StatsPolicy (see allocation_stats.hpp) records the peak count
+// and the elements dropped by OVERFLOW_OLDEST.
+template <typename T, std::size_t Size, template <typename, std::size_t> class StoragePolicy = HeapStorage,
+          typename StatsPolicy = NoStats>
+class CircularBuffer
 {
-    static_assert(((Size % 2U) == 0U), "CircularBuffer's Size must be a power of 2.");
+    static_assert(std::has_single_bit(Size), "CircularBuffer's Size must be a power of 2.");
     static_assert((Size > 0U), "CircularBuffer must have non-zero size.");
 
     static constexpr std::size_t SIZE = Size;
     static constexpr std::size_t LAST_INDEX = SIZE - 1U;
 
   public:
+    using value_type = T;
+    using iterator = RingIterator<T, SIZE>;
+    using const_iterator = RingIterator<const T, SIZE>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     // Default constructor
     CircularBuffer(OverflowBehaviour behaviour = OverflowBehaviour::THROW_EXCEPTION)
-        : buffer_{std::make_unique<T[]>(SIZE)}, head_{0U}, tail_{0U}, count_{0U}, overflow_behaviour_{behaviour}
+        : storage_{}, head_{0U}, tail_{0U}, count_{0U}, overflow_behaviour_{behaviour}
     {
     }
 
-    template <typename U> void push(U &&value)
+    // Destructor
+    ~CircularBuffer()
     {
-        if (full())
+        clear();
+    }
+
+    CircularBuffer(const CircularBuffer &) = delete;
+    CircularBuffer &operator=(const CircularBuffer &) = delete;
+
+    // Move constructor, the storage itself cannot be moved so the elements are moved one by one
+    CircularBuffer(CircularBuffer &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : storage_{}, head_{0U}, tail_{0U}, count_{0U}, overflow_behaviour_{other.overflow_behaviour_}
+    {
+        moveFrom(other);
+    }
+
+    // Move assignment operator
+    CircularBuffer &operator=(CircularBuffer &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
         {
-            if (OverflowBehaviour::THROW_EXCEPTION == overflow_behaviour_)
-            {
-                throw std::runtime_error("CircularBuffer is full.");
-            }
-            else
-            {
-                // Overwrite the oldest element (at head_)
-                head_ = (head_ + 1U) & LAST_INDEX;
-                --count_;
-            }
+            clear();
+            overflow_behaviour_ = other.overflow_behaviour_;
+            moveFrom(other);
         }
 
-        buffer_[tail_] = std::forward<U>(value);
-        tail_ = (tail_ + 1U) & LAST_INDEX;
-        ++count_;
+        return *this;
+    }
+
+    // Iterators run from the oldest to the newest element and are invalidated by any push or pop
+    inline iterator begin() noexcept
+    {
+        return iterator{storage_.buffer(), head_, 0U};
+    }
+
+    inline iterator end() noexcept
+    {
+        return iterator{storage_.buffer(), head_, count_};
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator{storage_.buffer(), head_, 0U};
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator{storage_.buffer(), head_, count_};
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    inline reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator{end()};
+    }
+
+    inline reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{begin()};
+    }
+
+    inline const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator{end()};
+    }
+
+    inline const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator{begin()};
+    }
+
+    inline const_reverse_iterator crbegin() const noexcept
+    {
+        return rbegin();
+    }
+
+    inline const_reverse_iterator crend() const noexcept
+    {
+        return rend();
+    }
+
+    template <typename U> void push(U &&value)
+    {
+        emplace(std::forward<U>(value));
     }
 
     template <typename U> bool try_push(U &&value) noexcept
@@ -59,9 +174,10 @@ template <typename T, std::size_t Size> class CircularBuffer
             return false;
         }
 
-        buffer_[tail_] = std::forward<U>(value);
+        new (slot(tail_)) T{std::forward<U>(value)};
         tail_ = (tail_ + 1U) & LAST_INDEX;
         ++count_;
+        stats_.onSize(count_);
 
         // Successfully pushed
         return true;
@@ -77,15 +193,22 @@ template <typename T, std::size_t Size> class CircularBuffer
             }
             else
             {
-                // Overwrite the oldest element (at head_)
-                head_ = (head_ + 1U) & LAST_INDEX;
-                --count_;
+                // Overwrite the oldest element (at head_, the slot the new one goes to). The new element is built
+                // first, the arguments may refer to the oldest element, e.g. push(front()).
+                T element{std::forward<Args>(args)...};
+                dropOldest(1U);
+                stats_.onDrop(1U);
+                new (slot(tail_)) T{std::move(element)};
             }
         }
+        else
+        {
+            new (slot(tail_)) T{std::forward<Args>(args)...};
+        }
 
-        new (&buffer_[tail_]) T{std::forward<Args>(args)...};
         tail_ = (tail_ + 1U) & LAST_INDEX;
         ++count_;
+        stats_.onSize(count_);
     }
 
     template <typename... Args> bool try_emplace(Args &&...args) noexcept
@@ -96,9 +219,10 @@ template <typename T, std::size_t Size> class CircularBuffer
             return false;
         }
 
-        new (&buffer_[tail_]) T{std::forward<Args>(args)...};
+        new (slot(tail_)) T{std::forward<Args>(args)...};
         tail_ = (tail_ + 1U) & LAST_INDEX;
         ++count_;
+        stats_.onSize(count_);
 
         // Successfully emplaced
         return true;
@@ -111,9 +235,8 @@ template <typename T, std::size_t Size> class CircularBuffer
             throw std::runtime_error("Buffer is empty.");
         }
 
-        T value = std::move(buffer_[head_]);
-        head_ = (head_ + 1U) & LAST_INDEX;
-        --count_;
+        T value = std::move(*slot(head_));
+        dropOldest(1U);
 
         return value;
     }
@@ -126,14 +249,121 @@ template <typename T, std::size_t Size> class CircularBuffer
             return false;
         }
 
-        out_value = std::move(buffer_[head_]);
-        head_ = (head_ + 1U) & LAST_INDEX;
-        --count_;
+        out_value = std::move(*slot(head_));
+        dropOldest(1U);
 
         // Successfully popped
         return true;
     }
 
+    // Pushes all elements or none. With OVERFLOW_OLDEST the oldest elements are dropped to make room, and only the
+    // last SIZE values are kept when more than SIZE values are pushed.
+    void push_n(const T *values, std::size_t count)
+    {
+        if (count > (SIZE - count_))
+        {
+            if (OverflowBehaviour::THROW_EXCEPTION == overflow_behaviour_)
+            {
+                throw std::runtime_error("CircularBuffer is full.");
+            }
+            else
+            {
+                std::size_t skipped = 0U;
+                if (count > SIZE)
+                {
+                    skipped = count - SIZE;
+                    values += skipped;
+                    count = SIZE;
+                }
+
+                // Overwrite the oldest elements (at head_)
+                const std::size_t overwritten = count - (SIZE - count_);
+                dropOldest(overwritten);
+                stats_.onDrop(skipped + overwritten);
+            }
+        }
+
+        copyIn(values, count);
+    }
+
+    // Pushes as many elements as fit, returns the number of elements pushed
+    std::size_t try_push_n(const T *values, const std::size_t count) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    {
+        const std::size_t pushed = std::min(count, SIZE - count_);
+        copyIn(values, pushed);
+        return pushed;
+    }
+
+    // Pops exactly count elements or throws without popping anything
+    void pop_n(T *out_values, const std::size_t count)
+    {
+        if (count > count_)
+        {
+            throw std::runtime_error("Buffer does not contain enough elements.");
+        }
+
+        copyOut(out_values, count);
+    }
+
+    // Pops up to count elements, returns the number of elements popped
+    std::size_t try_pop_n(T *out_values, const std::size_t count) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        const std::size_t popped = std::min(count, count_);
+        copyOut(out_values, popped);
+        return popped;
+    }
+
+    // Returns up to count free slots after the back of the buffer. Values written into the spans become part of the
+    // buffer once commit_write() is called. Restricted to trivially copyable types, whose lifetime starts when their
+    // bytes are written into the storage.
+    RingSegments<T> reserve_write(const std::size_t count) noexcept
+        requires std::is_trivially_copyable_v<T>
+    {
+        return makeSegments(storage_.buffer(), tail_, std::min(count, SIZE - count_));
+    }
+
+    void commit_write(const std::size_t count)
+        requires std::is_trivially_copyable_v<T>
+    {
+        if (count > (SIZE - count_))
+        {
+            throw std::runtime_error("Commit exceeds the free space of the buffer.");
+        }
+
+        tail_ = (tail_ + count) & LAST_INDEX;
+        count_ += count;
+        stats_.onSize(count_);
+    }
+
+    // Returns up to count elements from the front of the buffer without popping them
+    RingSegments<const T> peek_read(const std::size_t count) const noexcept
+    {
+        return makeSegments(storage_.buffer(), head_, std::min(count, count_));
+    }
+
+    // Removes count elements from the front of the buffer, typically after they have been processed via peek_read()
+    void release_read(const std::size_t count)
+    {
+        if (count > count_)
+        {
+            throw std::runtime_error("Release exceeds the size of the buffer.");
+        }
+
+        dropOldest(count);
+    }
+
+    // All elements as the two contiguous chunks of the storage, oldest first. Loops over the spans run on plain arrays
+    // and vectorise, unlike loops over the iterators, which mask every index.
+    inline RingSegments<T> segments() noexcept
+    {
+        return makeSegments(storage_.buffer(), head_, count_);
+    }
+
+    inline RingSegments<const T> segments() const noexcept
+    {
+        return makeSegments(storage_.buffer(), head_, count_);
+    }
+
     inline const T &front() const
     {
         if (empty())
@@ -141,7 +371,7 @@ template <typename T, std::size_t Size> class CircularBuffer
             throw std::runtime_error("Buffer is empty.");
         }
 
-        return buffer_[head_];
+        return *slot(head_);
     }
 
     inline const T &back() const
@@ -152,7 +382,14 @@ template <typename T, std::size_t Size> class CircularBuffer
         }
 
         const std::size_t last_index = (tail_ == 0U) ? LAST_INDEX : (tail_ - 1U);
-        return buffer_[last_index];
+        return *slot(last_index);
+    }
+
+    inline void clear() noexcept
+    {
+        dropOldest(count_);
+        head_ = 0U;
+        tail_ = 0U;
     }
 
     inline bool empty() const noexcept
@@ -170,15 +407,137 @@ template <typename T, std::size_t Size> class CircularBuffer
         return count_;
     }
 
+    // Snapshot of the peak count and the dropped elements, safe to call from any thread
+    inline ContainerStatsSnapshot stats() const noexcept
+        requires(ContainerStatsRecorder<StatsPolicy>::ENABLED)
+    {
+        return stats_.snapshot();
+    }
+
+    // True if the storage maps its memory twice back to back, so regions never have to be split at the wrap point
+    inline bool mirrored() const noexcept
+    {
+        if constexpr (requires(const StoragePolicy<T, SIZE> &storage) { storage.mirrored(); })
+        {
+            return storage_.mirrored();
+        }
+        else
+        {
+            return false;
+        }
+    }
+
   private:
-    std::unique_ptr<T[]> buffer_;
+    inline T *slot(const std::size_t index) noexcept
+    {
+        return storage_.buffer() + index;
+    }
+
+    inline const T *slot(const std::size_t index) const noexcept
+    {
+        return storage_.buffer() + index;
+    }
+
+    template <typename U>
+    inline RingSegments<U> makeSegments(U *data, const std::size_t start, const std::size_t count) const noexcept
+    {
+        const std::size_t first_count = mirrored() ? count : std::min(count, SIZE - start);
+        return RingSegments<U>{std::span<U>{data + start, first_count}, std::span<U>{data, count - first_count}};
+    }
+
+    // Destroys count elements at the front of the buffer
+    inline void dropOldest(const std::size_t count) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const RingSegments<T> region = makeSegments(storage_.buffer(), head_, count);
+            std::destroy(region.first.begin(), region.first.end());
+            std::destroy(region.second.begin(), region.second.end());
+        }
+
+        head_ = (head_ + count) & LAST_INDEX;
+        count_ -= count;
+    }
+
+    // Caller guarantees that count does not exceed the free space
+    inline void copyIn(const T *values, const std::size_t count)
+    {
+        const RingSegments<T> region = makeSegments(storage_.buffer(), tail_, count);
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (count > 0U)
+            {
+                std::memcpy(region.first.data(), values, region.first.size_bytes());
+                std::memcpy(region.second.data(), values + region.first.size(), region.second.size_bytes());
+            }
+        }
+        else
+        {
+            T *const first_end = std::uninitialized_copy(values, values + region.first.size(), region.first.data());
+            try
+            {
+                std::uninitialized_copy(values + region.first.size(), values + count, region.second.data());
+            }
+            catch (...)
+            {
+                std::destroy(region.first.data(), first_end);
+                throw;
+            }
+        }
+
+        tail_ = (tail_ + count) & LAST_INDEX;
+        count_ += count;
+        stats_.onSize(count_);
+    }
+
+    // Caller guarantees that count does not exceed the size
+    inline void copyOut(T *out_values, const std::size_t count)
+    {
+        const RingSegments<T> region = makeSegments(storage_.buffer(), head_, count);
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (count > 0U)
+            {
+                std::memcpy(out_values, region.first.data(), region.first.size_bytes());
+                std::memcpy(out_values + region.first.size(), region.second.data(), region.second.size_bytes());
+            }
+        }
+        else
+        {
+            std::move(region.first.begin(), region.first.end(), out_values);
+            std::move(region.second.begin(), region.second.end(), out_values + region.first.size());
+        }
+
+        dropOldest(count);
+    }
+
+    inline void moveFrom(CircularBuffer &other)
+    {
+        for (std::size_t i = 0U; i < other.count_; ++i)
+        {
+            new (slot(i)) T{std::move(*other.slot((other.head_ + i) & LAST_INDEX))};
+            ++count_;
+        }
+        tail_ = count_ & LAST_INDEX;
+        stats_.onSize(count_);
+        other.clear();
+    }
+
+    StoragePolicy<T, SIZE> storage_;
     std::size_t head_;
     std::size_t tail_;
     std::size_t count_;
 
     // Behaviour when the buffer is full
     OverflowBehaviour overflow_behaviour_;
+
+    [[no_unique_address]] ContainerStatsRecorder<StatsPolicy> stats_;
 };
+
+template <typename T, std::size_t Size> using StackCircularBuffer = CircularBuffer<T, Size, StackStorage>;
+template <typename T, std::size_t Size> using HeapCircularBuffer = CircularBuffer<T, Size, HeapStorage>;
 } // namespace containers
 
 #endif // CONTAINERS_CIRCULAR_BUFFER_HPP
@@ -0,0 +1,281 @@
+#ifndef CONTAINERS_CONCURRENT_POOL_HPP
+#define CONTAINERS_CONCURRENT_POOL_HPP
+
+#include "cache_line.hpp"
+#include "reserved_pool_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Fixed-size block pool shared between threads. Every thread allocates through its own ThreadCache, which keeps a
+// magazine of up to 2 * BatchSize free blocks and only touches shared state when the magazine runs empty or full.
+// Shared state is a lock-free stack of batches (chains of BatchSize free blocks) plus a bump index over blocks that
+// were never handed out. Blocks freed on a different thread than the one that allocated them land in the freeing
+// thread's magazine and flow back to the central stack a whole batch at a time.
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class StoragePolicy,
+          std::size_t BatchSize = 32U>
+class ConcurrentPool
+{
+    static_assert(std::is_same_v<typename StoragePolicy<T, MaxSize>::Policy, StackPolicy> ||
+                      std::is_same_v<typename StoragePolicy<T, MaxSize>::Policy, HeapPolicy>,
+                  "StoragePolicy must be either StackStorage or HeapStorage");
+    static_assert((BatchSize > 0U), "ConcurrentPool's BatchSize must be non-zero.");
+    static_assert((MaxSize < UINT32_MAX), "ConcurrentPool indexes blocks with 32 bits.");
+
+    static constexpr std::uint32_t NIL = UINT32_MAX;
+
+    // Links live outside the blocks, so a thread that lost a race can still read a link while the block is in use
+    struct Link
+    {
+        std::atomic<std::uint32_t> next_batch{NIL};
+        std::uint32_t next_in_batch{NIL};
+    };
+
+  public:
+    static constexpr auto MAX_SIZE = MaxSize;
+    static constexpr auto BATCH_SIZE = BatchSize;
+
+    class ThreadCache;
+
+    ConcurrentPool() : central_{pack(NIL, 0U)}, fresh_{0U}
+    {
+        for (std::size_t i = 0U; i < MaxSize; ++i)
+        {
+            new (links_.buffer() + i) Link{};
+        }
+    }
+
+    ~ConcurrentPool() = default;
+
+    // Threads hold pointers into the pool, it must not be copied or moved
+    ConcurrentPool(const ConcurrentPool &) = delete;
+    ConcurrentPool &operator=(const ConcurrentPool &) = delete;
+    ConcurrentPool(ConcurrentPool &&) = delete;
+    ConcurrentPool &operator=(ConcurrentPool &&) = delete;
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MAX_SIZE;
+    }
+
+  private:
+    static constexpr inline std::uint64_t pack(const std::uint32_t head, const std::uint32_t tag) noexcept
+    {
+        return (static_cast<std::uint64_t>(tag) << 32U) | head;
+    }
+
+    inline Link &link(const std::uint32_t index) noexcept
+    {
+        return links_.buffer()[index];
+    }
+
+    inline T *block(const std::uint32_t index) noexcept
+    {
+        return blocks_.buffer() + index;
+    }
+
+    inline std::uint32_t indexOf(const T *p) noexcept
+    {
+        return static_cast<std::uint32_t>(p - blocks_.buffer());
+    }
+
+    // Pushes a batch whose blocks are already chained through next_in_batch. The tag changes on every update so a
+    // concurrent pop that read a stale head cannot succeed (ABA).
+    void pushBatch(const std::uint32_t head) noexcept
+    {
+        std::uint64_t old_central = central_.value.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            link(head).next_batch.store(static_cast<std::uint32_t>(old_central), std::memory_order_relaxed);
+            const std::uint64_t new_central = pack(head, static_cast<std::uint32_t>(old_central >> 32U) + 1U);
+            if (central_.value.compare_exchange_weak(old_central, new_central, std::memory_order_release,
+                                                     std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    // Returns the head of a chain of free blocks, or NIL if the central stack is empty
+    std::uint32_t popBatch() noexcept
+    {
+        std::uint64_t old_central = central_.value.load(std::memory_order_acquire);
+        for (;;)
+        {
+            const std::uint32_t head = static_cast<std::uint32_t>(old_central);
+            if (head == NIL)
+            {
+                return NIL;
+            }
+
+            const std::uint32_t next = link(head).next_batch.load(std::memory_order_relaxed);
+            const std::uint64_t new_central = pack(next, static_cast<std::uint32_t>(old_central >> 32U) + 1U);
+            if (central_.value.compare_exchange_weak(old_central, new_central, std::memory_order_acquire,
+                                                     std::memory_order_acquire))
+            {
+                return head;
+            }
+        }
+    }
+
+    // Claims up to BatchSize blocks that were never handed out, returns the first index and the number of blocks
+    std::pair<std::uint32_t, std::size_t> carveFresh() noexcept
+    {
+        if (fresh_.value.load(std::memory_order_relaxed) >= MaxSize)
+        {
+            return {NIL, 0U};
+        }
+
+        const std::size_t first = fresh_.value.fetch_add(BatchSize, std::memory_order_relaxed);
+        if (first >= MaxSize)
+        {
+            return {NIL, 0U};
+        }
+
+        return {static_cast<std::uint32_t>(first), std::min(BatchSize, MaxSize - first)};
+    }
+
+    struct alignas(CACHE_LINE_SIZE) Central
+    {
+        std::atomic<std::uint64_t> value;
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Fresh
+    {
+        std::atomic<std::size_t> value;
+    };
+
+    StoragePolicy<T, MaxSize> blocks_;
+    StoragePolicy<Link, MaxSize> links_;
+    Central central_;
+    Fresh fresh_;
+};
+
+// Per-thread front end of a ConcurrentPool. Must only be used by the thread that created it; blocks may be freed
+// through any thread's cache. Cached blocks are returned to the pool on destruction.
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class StoragePolicy, std::size_t BatchSize>
+class ConcurrentPool<T, MaxSize, StoragePolicy, BatchSize>::ThreadCache
+{
+    static constexpr std::size_t CAPACITY = 2U * BatchSize;
+
+  public:
+    explicit ThreadCache(ConcurrentPool &pool) noexcept : pool_{pool}, count_{0U}
+    {
+    }
+
+    ~ThreadCache()
+    {
+        while (count_ > 0U)
+        {
+            flush(std::min(count_, BatchSize));
+        }
+    }
+
+    ThreadCache(const ThreadCache &) = delete;
+    ThreadCache &operator=(const ThreadCache &) = delete;
+    ThreadCache(ThreadCache &&) = delete;
+    ThreadCache &operator=(ThreadCache &&) = delete;
+
+    // Returns uninitialised memory for one T, throws std::bad_alloc if the pool is exhausted
+    T *allocate()
+    {
+        if ((count_ == 0U) && !refill())
+        {
+            throw std::bad_alloc();
+        }
+
+        return pool_.block(magazine_[--count_]);
+    }
+
+    void deallocate(T *p) noexcept
+    {
+        if (count_ == CAPACITY)
+        {
+            flush(BatchSize);
+        }
+
+        magazine_[count_++] = pool_.indexOf(p);
+    }
+
+    template <typename... Args> T *create(Args &&...args)
+    {
+        T *const p = allocate();
+        try
+        {
+            return new (p) T{std::forward<Args>(args)...};
+        }
+        catch (...)
+        {
+            deallocate(p);
+            throw;
+        }
+    }
+
+    void destroy(T *p) noexcept
+    {
+        p->~T();
+        deallocate(p);
+    }
+
+    // Number of free blocks held by this thread
+    inline std::size_t cached() const noexcept
+    {
+        return count_;
+    }
+
+  private:
+    bool refill() noexcept
+    {
+        std::uint32_t index = pool_.popBatch();
+        if (index != NIL)
+        {
+            for (; index != NIL; index = pool_.link(index).next_in_batch)
+            {
+                magazine_[count_++] = index;
+            }
+            return true;
+        }
+
+        const auto [first, count] = pool_.carveFresh();
+        for (std::size_t i = count; i > 0U; --i)
+        {
+            magazine_[count_++] = first + static_cast<std::uint32_t>(i - 1U);
+        }
+        return (count > 0U);
+    }
+
+    // Chains the top count blocks of the magazine and hands them to the central stack
+    void flush(const std::size_t count) noexcept
+    {
+        const std::size_t first = count_ - count;
+        for (std::size_t i = first; (i + 1U) < count_; ++i)
+        {
+            pool_.link(magazine_[i]).next_in_batch = magazine_[i + 1U];
+        }
+        pool_.link(magazine_[count_ - 1U]).next_in_batch = NIL;
+
+        pool_.pushBatch(magazine_[first]);
+        count_ = first;
+    }
+
+    ConcurrentPool &pool_;
+    std::size_t count_;
+    std::array<std::uint32_t, CAPACITY> magazine_;
+};
+
+template <typename T, std::size_t MaxSize, std::size_t BatchSize = 32U>
+using StackConcurrentPool = ConcurrentPool<T, MaxSize, StackStorage, BatchSize>;
+
+template <typename T, std::size_t MaxSize, std::size_t BatchSize = 32U>
+using HeapConcurrentPool = ConcurrentPool<T, MaxSize, HeapStorage, BatchSize>;
+} // namespace containers
+
+#endif // CONTAINERS_CONCURRENT_POOL_HPP
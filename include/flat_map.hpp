@@ -0,0 +1,510 @@
+#ifndef CONTAINERS_FLAT_MAP_HPP
+#define CONTAINERS_FLAT_MAP_HPP
+
+#include "generic_vector.hpp"
+#include "sorted_index_algorithms.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Sorted associative container on two GenericVectors: keys and values are kept in separate arrays (structure of
+// arrays), so a lookup only touches the key array. Lookups are branchless binary searches; insertion and erasure
+// shift the following elements. Heterogeneous lookup is available when Compare defines is_transparent, which the
+// default std::less<> does.
+template <typename K, typename V, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename Compare = std::less<>>
+class FlatMap
+{
+    static constexpr bool IS_TRANSPARENT = requires { typename Compare::is_transparent; };
+
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using key_compare = Compare;
+
+    static constexpr auto MAX_SIZE = MaxSize;
+
+    // Iterators dereference to a pair of references into the key and value arrays
+    template <bool IsConst> class basic_iterator final
+    {
+        using Map = std::conditional_t<IsConst, const FlatMap, FlatMap>;
+
+      public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::pair<K, V>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const K &, std::conditional_t<IsConst, const V &, V &>>;
+
+        struct pointer
+        {
+            reference ref;
+
+            inline reference *operator->() noexcept
+            {
+                return &ref;
+            }
+        };
+
+        basic_iterator() noexcept = default;
+
+        basic_iterator(Map *map, const std::size_t index) noexcept : map_{map}, index_{index}
+        {
+        }
+
+        // Allow conversion from iterator to const_iterator
+        template <bool OtherConst>
+            requires(IsConst && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst> &other) noexcept : map_{other.map_}, index_{other.index_}
+        {
+        }
+
+        inline reference operator*() const noexcept
+        {
+            return reference{map_->keys_[index_], map_->values_[index_]};
+        }
+        inline pointer operator->() const noexcept
+        {
+            return pointer{**this};
+        }
+
+        // Arithmetic operations
+        inline basic_iterator &operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+        inline basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++index_;
+            return temp;
+        }
+        inline basic_iterator &operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+        inline basic_iterator operator--(int) noexcept
+        {
+            basic_iterator temp = *this;
+            --index_;
+            return temp;
+        }
+        inline basic_iterator &operator+=(const difference_type n) noexcept
+        {
+            index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n);
+            return *this;
+        }
+        inline basic_iterator &operator-=(const difference_type n) noexcept
+        {
+            index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) - n);
+            return *this;
+        }
+        inline basic_iterator operator+(const difference_type n) const noexcept
+        {
+            basic_iterator temp = *this;
+            return (temp += n);
+        }
+        inline friend basic_iterator operator+(const difference_type n, const basic_iterator &it) noexcept
+        {
+            return (it + n);
+        }
+        inline basic_iterator operator-(const difference_type n) const noexcept
+        {
+            basic_iterator temp = *this;
+            return (temp -= n);
+        }
+        inline difference_type operator-(const basic_iterator &other) const noexcept
+        {
+            return (static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_));
+        }
+
+        // Comparison operators
+        inline friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ == b.index_);
+        }
+        inline friend bool operator!=(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ != b.index_);
+        }
+        inline friend bool operator<(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ < b.index_);
+        }
+        inline friend bool operator>(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ > b.index_);
+        }
+        inline friend bool operator<=(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ <= b.index_);
+        }
+        inline friend bool operator>=(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ >= b.index_);
+        }
+
+        // Subscript operator
+        inline reference operator[](const difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+      private:
+        friend class FlatMap;
+        template <bool> friend class basic_iterator;
+
+        Map *map_{nullptr};
+        std::size_t index_{0U};
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    inline iterator begin() noexcept
+    {
+        return iterator{this, 0U};
+    }
+
+    inline iterator end() noexcept
+    {
+        return iterator{this, size()};
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator{this, 0U};
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator{this, size()};
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    // Inserts the value if the key is not present. Returns the element with the key and whether it was inserted.
+    template <typename... Args> std::pair<iterator, bool> try_emplace(const K &key, Args &&...args)
+    {
+        const std::size_t index = lowerBoundIndex(key);
+        if ((index < size()) && !compare_(key, keys_[index]))
+        {
+            return {iterator{this, index}, false};
+        }
+
+        if (size() >= MAX_SIZE)
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        sorted_index::insertAt(values_, index, V{std::forward<Args>(args)...});
+        try
+        {
+            sorted_index::insertAt(keys_, index, key);
+        }
+        catch (...)
+        {
+            sorted_index::eraseAt(values_, index);
+            throw;
+        }
+
+        return {iterator{this, index}, true};
+    }
+
+    inline std::pair<iterator, bool> insert(const value_type &value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    inline std::pair<iterator, bool> insert(value_type &&value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    template <typename U> std::pair<iterator, bool> insert_or_assign(const K &key, U &&value)
+    {
+        const std::size_t index = findIndex(key);
+        if (index != size())
+        {
+            values_[index] = std::forward<U>(value);
+            return {iterator{this, index}, false};
+        }
+
+        return try_emplace(key, std::forward<U>(value));
+    }
+
+    // Inserts a range of key/value pairs with a single sort and merge instead of one shift per element. If the range
+    // contains equivalent keys it is unspecified which of them is inserted. The whole range must fit into the
+    // remaining capacity before duplicates are removed, otherwise it throws without modifying the map.
+    template <typename InputIt> void insert_range(InputIt first, InputIt last)
+    {
+        const std::size_t old_size = size();
+
+        try
+        {
+            for (; first != last; ++first)
+            {
+                keys_.push_back(first->first);
+                values_.push_back(first->second);
+            }
+        }
+        catch (...)
+        {
+            sorted_index::truncate(keys_, old_size);
+            sorted_index::truncate(values_, old_size);
+            throw;
+        }
+
+        const auto less = [this](const std::size_t i, const std::size_t j) { return compare_(keys_[i], keys_[j]); };
+        const auto swap = [this](const std::size_t i, const std::size_t j) {
+            using std::swap;
+            swap(keys_[i], keys_[j]);
+            swap(values_[i], values_[j]);
+        };
+
+        sorted_index::heapSort(old_size, size(), less, swap);
+
+        // Drop duplicates within the new elements and keys that are already present, both ranges are sorted
+        std::size_t write = old_size;
+        std::size_t existing = 0U;
+        for (std::size_t read = old_size; read < size(); ++read)
+        {
+            while ((existing < old_size) && less(existing, read))
+            {
+                ++existing;
+            }
+
+            const bool present = (existing < old_size) && !less(read, existing);
+            const bool duplicate = (write > old_size) && !less(write - 1U, read);
+            if (!present && !duplicate)
+            {
+                if (write != read)
+                {
+                    swap(write, read);
+                }
+                ++write;
+            }
+        }
+
+        sorted_index::truncate(keys_, write);
+        sorted_index::truncate(values_, write);
+        sorted_index::mergeInPlace(0U, old_size, write, less, swap);
+    }
+
+    inline iterator erase(const_iterator position)
+    {
+        sorted_index::eraseAt(keys_, position.index_);
+        sorted_index::eraseAt(values_, position.index_);
+        return iterator{this, position.index_};
+    }
+
+    // Returns the number of erased elements (0 or 1)
+    std::size_t erase(const K &key)
+    {
+        return eraseKey(key);
+    }
+
+    template <typename KeyLike>
+        requires(IS_TRANSPARENT && !std::is_convertible_v<KeyLike, const_iterator>)
+    std::size_t erase(const KeyLike &key)
+    {
+        return eraseKey(key);
+    }
+
+    inline iterator find(const K &key) noexcept
+    {
+        return iterator{this, findIndex(key)};
+    }
+
+    inline const_iterator find(const K &key) const noexcept
+    {
+        return const_iterator{this, findIndex(key)};
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline iterator find(const KeyLike &key) noexcept
+    {
+        return iterator{this, findIndex(key)};
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline const_iterator find(const KeyLike &key) const noexcept
+    {
+        return const_iterator{this, findIndex(key)};
+    }
+
+    inline bool contains(const K &key) const noexcept
+    {
+        return (findIndex(key) != size());
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline bool contains(const KeyLike &key) const noexcept
+    {
+        return (findIndex(key) != size());
+    }
+
+    // First element whose key is not less than key
+    inline iterator lower_bound(const K &key) noexcept
+    {
+        return iterator{this, lowerBoundIndex(key)};
+    }
+
+    inline const_iterator lower_bound(const K &key) const noexcept
+    {
+        return const_iterator{this, lowerBoundIndex(key)};
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline iterator lower_bound(const KeyLike &key) noexcept
+    {
+        return iterator{this, lowerBoundIndex(key)};
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline const_iterator lower_bound(const KeyLike &key) const noexcept
+    {
+        return const_iterator{this, lowerBoundIndex(key)};
+    }
+
+    inline V &at(const K &key)
+    {
+        return values_[checkedIndex(key)];
+    }
+
+    inline const V &at(const K &key) const
+    {
+        return values_[checkedIndex(key)];
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline V &at(const KeyLike &key)
+    {
+        return values_[checkedIndex(key)];
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline const V &at(const KeyLike &key) const
+    {
+        return values_[checkedIndex(key)];
+    }
+
+    inline V &operator[](const K &key)
+    {
+        return values_[try_emplace(key).first.index_];
+    }
+
+    // Contiguous, sorted key array
+    inline std::span<const K> keys() const noexcept
+    {
+        return std::span<const K>{&keys_[0U], keys_.size()};
+    }
+
+    // Contiguous value array, in key order
+    inline std::span<V> values() noexcept
+    {
+        return std::span<V>{&values_[0U], values_.size()};
+    }
+
+    inline std::span<const V> values() const noexcept
+    {
+        return std::span<const V>{&values_[0U], values_.size()};
+    }
+
+    inline void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return keys_.size();
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MAX_SIZE;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return keys_.empty();
+    }
+
+  private:
+    template <typename KeyLike> inline std::size_t lowerBoundIndex(const KeyLike &key) const noexcept
+    {
+        return sorted_index::lowerBound(&keys_[0U], keys_.size(), key, compare_);
+    }
+
+    // Returns size() if the key is not present
+    template <typename KeyLike> inline std::size_t findIndex(const KeyLike &key) const noexcept
+    {
+        const std::size_t index = lowerBoundIndex(key);
+        return ((index < size()) && !compare_(key, keys_[index])) ? index : size();
+    }
+
+    template <typename KeyLike> inline std::size_t checkedIndex(const KeyLike &key) const
+    {
+        const std::size_t index = findIndex(key);
+        if (index == size())
+        {
+            throw std::out_of_range("Key not found.");
+        }
+
+        return index;
+    }
+
+    template <typename KeyLike> std::size_t eraseKey(const KeyLike &key)
+    {
+        const std::size_t index = findIndex(key);
+        if (index == size())
+        {
+            return 0U;
+        }
+
+        sorted_index::eraseAt(keys_, index);
+        sorted_index::eraseAt(values_, index);
+        return 1U;
+    }
+
+    GenericVector<K, MaxSize, AllocationPolicy> keys_;
+    GenericVector<V, MaxSize, AllocationPolicy> values_;
+    [[no_unique_address]] Compare compare_;
+};
+
+template <typename K, typename V, std::size_t MaxSize, typename Compare = std::less<>>
+using StackFlatMap = FlatMap<K, V, MaxSize, StackAllocationPolicy, Compare>;
+
+template <typename K, typename V, std::size_t MaxSize, typename Compare = std::less<>>
+using HeapFlatMap = FlatMap<K, V, MaxSize, HeapAllocationPolicy, Compare>;
+} // namespace containers
+
+#endif // CONTAINERS_FLAT_MAP_HPP
@@ -0,0 +1,248 @@
+#ifndef CONTAINERS_FLAT_SET_HPP
+#define CONTAINERS_FLAT_SET_HPP
+
+#include "generic_vector.hpp"
+#include "sorted_index_algorithms.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Sorted set on a GenericVector. Lookups are branchless binary searches; insertion and erasure shift the following
+// elements. Heterogeneous lookup is available when Compare defines is_transparent, which the default std::less<> does.
+template <typename K, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename Compare = std::less<>>
+class FlatSet
+{
+    static constexpr bool IS_TRANSPARENT = requires { typename Compare::is_transparent; };
+
+    using Vector = GenericVector<K, MaxSize, AllocationPolicy>;
+
+  public:
+    using key_type = K;
+    using value_type = K;
+    using key_compare = Compare;
+
+    // Keys must not be modified through iterators, so only constant iterators are provided
+    using iterator = typename Vector::const_iterator;
+    using const_iterator = typename Vector::const_iterator;
+
+    static constexpr auto MAX_SIZE = MaxSize;
+
+    inline const_iterator begin() const noexcept
+    {
+        return keys_.cbegin();
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return keys_.cend();
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return keys_.cbegin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return keys_.cend();
+    }
+
+    // Returns the element equal to key and whether it was inserted
+    template <typename U> std::pair<const_iterator, bool> insert(U &&key)
+    {
+        const std::size_t index = lowerBoundIndex(key);
+        if ((index < size()) && !compare_(key, keys_[index]))
+        {
+            return {begin() + static_cast<std::ptrdiff_t>(index), false};
+        }
+
+        if (size() >= MAX_SIZE)
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        sorted_index::insertAt(keys_, index, K{std::forward<U>(key)});
+        return {begin() + static_cast<std::ptrdiff_t>(index), true};
+    }
+
+    // Inserts a range of keys with a single sort and merge instead of one shift per element. The whole range must fit
+    // into the remaining capacity before duplicates are removed, otherwise it throws without modifying the set.
+    template <typename InputIt> void insert_range(InputIt first, InputIt last)
+    {
+        const std::size_t old_size = size();
+
+        try
+        {
+            for (; first != last; ++first)
+            {
+                keys_.push_back(*first);
+            }
+        }
+        catch (...)
+        {
+            sorted_index::truncate(keys_, old_size);
+            throw;
+        }
+
+        const auto less = [this](const std::size_t i, const std::size_t j) { return compare_(keys_[i], keys_[j]); };
+        const auto swap = [this](const std::size_t i, const std::size_t j) {
+            using std::swap;
+            swap(keys_[i], keys_[j]);
+        };
+
+        sorted_index::heapSort(old_size, size(), less, swap);
+
+        // Drop duplicates within the new keys and keys that are already present, both ranges are sorted
+        std::size_t write = old_size;
+        std::size_t existing = 0U;
+        for (std::size_t read = old_size; read < size(); ++read)
+        {
+            while ((existing < old_size) && less(existing, read))
+            {
+                ++existing;
+            }
+
+            const bool present = (existing < old_size) && !less(read, existing);
+            const bool duplicate = (write > old_size) && !less(write - 1U, read);
+            if (!present && !duplicate)
+            {
+                if (write != read)
+                {
+                    swap(write, read);
+                }
+                ++write;
+            }
+        }
+
+        sorted_index::truncate(keys_, write);
+        sorted_index::mergeInPlace(0U, old_size, write, less, swap);
+    }
+
+    inline const_iterator erase(const_iterator position)
+    {
+        const std::size_t index = static_cast<std::size_t>(position - begin());
+        sorted_index::eraseAt(keys_, index);
+        return begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    // Returns the number of erased elements (0 or 1)
+    std::size_t erase(const K &key)
+    {
+        return eraseKey(key);
+    }
+
+    template <typename KeyLike>
+        requires(IS_TRANSPARENT && !std::is_convertible_v<KeyLike, const_iterator>)
+    std::size_t erase(const KeyLike &key)
+    {
+        return eraseKey(key);
+    }
+
+    inline const_iterator find(const K &key) const noexcept
+    {
+        return begin() + static_cast<std::ptrdiff_t>(findIndex(key));
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline const_iterator find(const KeyLike &key) const noexcept
+    {
+        return begin() + static_cast<std::ptrdiff_t>(findIndex(key));
+    }
+
+    inline bool contains(const K &key) const noexcept
+    {
+        return (findIndex(key) != size());
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline bool contains(const KeyLike &key) const noexcept
+    {
+        return (findIndex(key) != size());
+    }
+
+    // First element that is not less than key
+    inline const_iterator lower_bound(const K &key) const noexcept
+    {
+        return begin() + static_cast<std::ptrdiff_t>(lowerBoundIndex(key));
+    }
+
+    template <typename KeyLike>
+        requires IS_TRANSPARENT
+    inline const_iterator lower_bound(const KeyLike &key) const noexcept
+    {
+        return begin() + static_cast<std::ptrdiff_t>(lowerBoundIndex(key));
+    }
+
+    // Contiguous, sorted key array
+    inline std::span<const K> keys() const noexcept
+    {
+        return std::span<const K>{&keys_[0U], keys_.size()};
+    }
+
+    inline void clear() noexcept
+    {
+        keys_.clear();
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return keys_.size();
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MAX_SIZE;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return keys_.empty();
+    }
+
+  private:
+    template <typename KeyLike> inline std::size_t lowerBoundIndex(const KeyLike &key) const noexcept
+    {
+        return sorted_index::lowerBound(&keys_[0U], keys_.size(), key, compare_);
+    }
+
+    // Returns size() if the key is not present
+    template <typename KeyLike> inline std::size_t findIndex(const KeyLike &key) const noexcept
+    {
+        const std::size_t index = lowerBoundIndex(key);
+        return ((index < size()) && !compare_(key, keys_[index])) ? index : size();
+    }
+
+    template <typename KeyLike> std::size_t eraseKey(const KeyLike &key)
+    {
+        const std::size_t index = findIndex(key);
+        if (index == size())
+        {
+            return 0U;
+        }
+
+        sorted_index::eraseAt(keys_, index);
+        return 1U;
+    }
+
+    Vector keys_;
+    [[no_unique_address]] Compare compare_;
+};
+
+template <typename K, std::size_t MaxSize, typename Compare = std::less<>>
+using StackFlatSet = FlatSet<K, MaxSize, StackAllocationPolicy, Compare>;
+
+template <typename K, std::size_t MaxSize, typename Compare = std::less<>>
+using HeapFlatSet = FlatSet<K, MaxSize, HeapAllocationPolicy, Compare>;
+} // namespace containers
+
+#endif // CONTAINERS_FLAT_SET_HPP
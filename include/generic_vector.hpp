@@ -1,16 +1,23 @@
 #ifndef CONTAINERS_GENERIC_VECTOR_HPP
 #define CONTAINERS_GENERIC_VECTOR_HPP
 
+#include "allocation_stats.hpp"
 #include "heap_allocation_policy.hpp"
+#include "relocation.hpp"
 #include "stack_allocation_policy.hpp"
 
 #include <cstdint>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace containers
 {
-template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy>
+// StatsPolicy (see allocation_stats.hpp) records the peak size, e.g. to right-size MaxSize from production telemetry
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy = NoStats>
 class GenericVector : public AllocationPolicy<T, MaxSize>
 {
     using AllocationPolicy<T, MaxSize>::allocate;
@@ -32,21 +39,11 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
     }
 
     // Copy constructor
-    GenericVector(const GenericVector &other) : size_{other.size_}
+    GenericVector(const GenericVector &other) : size_{0U}
     {
-        try
-        {
-            for (std::size_t i = 0; i < other.size_; ++i)
-            {
-                allocate(i, other[i]);
-                ++size_;
-            }
-        }
-        catch (...)
-        {
-            clear();
-            throw;
-        }
+        uninitializedCopy(&other[0U], other.size_, &getData(0U));
+        size_ = other.size_;
+        stats_.onSize(size_);
     }
 
     // Copy assignment operator
@@ -55,37 +52,28 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
         if (this != &other)
         {
             clear();
-            try
-            {
-                for (std::size_t i = 0; i < other.size_; ++i)
-                {
-                    allocate(i, other[i]);
-                }
-                size_ = other.size_;
-            }
-            catch (...)
-            {
-                clear();
-                throw;
-            }
+            uninitializedCopy(&other[0U], other.size_, &getData(0U));
+            size_ = other.size_;
+            stats_.onSize(size_);
         }
 
         return *this;
     }
 
-    // Move constructor
-    GenericVector(GenericVector &&other) noexcept(noexcept(this->allocate(0U, std::move(other[0U]))))
-        : size_{other.size_}
+    // Move constructor, relocates the elements so the source is left empty
+    GenericVector(GenericVector &&other) noexcept(is_trivially_relocatable_v<T> ||
+                                                  std::is_nothrow_move_constructible_v<T>)
+        : size_{0U}
     {
-        for (std::size_t i = 0; i < other.size_; ++i)
-        {
-            allocate(i, std::move(other[i]));
-        }
+        uninitializedRelocate(&other[0U], other.size_, &getData(0U));
+        size_ = other.size_;
         other.size_ = 0U;
+        stats_.onSize(size_);
     }
 
     // Move assignment operator
-    GenericVector &operator=(GenericVector &&other) noexcept(noexcept(this->allocate(0U, std::move(other[0U]))))
+    GenericVector &operator=(GenericVector &&other) noexcept(is_trivially_relocatable_v<T> ||
+                                                             std::is_nothrow_move_constructible_v<T>)
     {
         if (this != &other)
         {
@@ -93,37 +81,23 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
             clear();
 
             // Transfer ownership of elements
-            for (std::size_t i = 0; i < other.size_; ++i)
-            {
-                allocate(i, std::move(other[i]));
-            }
+            uninitializedRelocate(&other[0U], other.size_, &getData(0U));
             size_ = other.size_;
             other.size_ = 0U;
+            stats_.onSize(size_);
         }
 
         return *this;
     }
 
-    void swap(GenericVector &other) noexcept
+    void swap(GenericVector &other) noexcept(is_trivially_relocatable_v<T> ||
+                                             (std::is_nothrow_move_constructible_v<T> &&
+                                              std::is_nothrow_swappable_v<T>))
     {
-        // Check if the allocation policies are the same
-        if constexpr (std::is_same_v<decltype(*this), decltype(other)>)
-        {
-            using std::swap;
-
-            // Swap sizes
-            swap(this->size_, other.size_);
-
-            // Swap contents
-            for (std::size_t i = 0; i < std::max(this->size_, other.size_); ++i)
-            {
-                swap(this->getData(i), other.getData(i));
-            }
-        }
-        else
-        {
-            throw std::logic_error("Cannot swap vectors with different allocation policies.");
-        }
+        swapElements(&getData(0U), size_, &other.getData(0U), other.size_);
+        std::swap(size_, other.size_);
+        stats_.onSize(size_);
+        other.stats_.onSize(other.size_);
     }
 
     class iterator final
@@ -396,6 +370,7 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
 
         allocate(size_, std::forward<U>(value));
         ++size_;
+        stats_.onSize(size_);
     }
 
     template <typename... Args> inline void emplace_back(Args &&...args)
@@ -407,6 +382,7 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
 
         allocate(size_, std::forward<Args>(args)...);
         ++size_;
+        stats_.onSize(size_);
     }
 
     inline void pop_back()
@@ -429,32 +405,21 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
 
         if (new_size < size_)
         {
-            for (std::size_t i = new_size; i < size_; ++i)
-            {
-                deallocate(i);
-            }
-            size_ = new_size;
+            destroyElements(&getData(new_size), size_ - new_size);
         }
         else if (new_size > size_)
         {
-            for (std::size_t i = size_; i < new_size; ++i)
-            {
-                allocate(i, value);
-                ++size_;
-            }
+            std::uninitialized_fill_n(&getData(size_), new_size - size_, value);
         }
 
         size_ = new_size;
+        stats_.onSize(size_);
     }
 
     inline void clear() noexcept
     {
         // Explicitly call the destructor for each constructed element
-        for (std::size_t i = 0U; i < size_; ++i)
-        {
-            deallocate(i);
-        }
-
+        destroyElements(&getData(0U), size_);
         size_ = 0U;
     }
 
@@ -503,6 +468,13 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
         return (size_ == 0U);
     }
 
+    // Snapshot of the peak size, safe to call from any thread
+    inline ContainerStatsSnapshot stats() const noexcept
+        requires(ContainerStatsRecorder<StatsPolicy>::ENABLED)
+    {
+        return stats_.snapshot();
+    }
+
     inline T &front()
     {
         if (size_ == 0U)
@@ -545,10 +517,12 @@ class GenericVector : public AllocationPolicy<T, MaxSize>
 
   private:
     std::size_t size_;
+    [[no_unique_address]] ContainerStatsRecorder<StatsPolicy> stats_;
 };
 
-template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocPolicy>
-void swap(GenericVector<T, MaxSize, AllocPolicy> &lhs, GenericVector<T, MaxSize, AllocPolicy> &rhs) noexcept
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocPolicy, typename StatsPolicy>
+void swap(GenericVector<T, MaxSize, AllocPolicy, StatsPolicy> &lhs,
+          GenericVector<T, MaxSize, AllocPolicy, StatsPolicy> &rhs) noexcept(noexcept(lhs.swap(rhs)))
 {
     lhs.swap(rhs);
 }
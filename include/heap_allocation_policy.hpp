@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <new>
 #include <utility>
 
 namespace containers
@@ -12,13 +13,14 @@ template <typename T, std::size_t MaxSize> class HeapAllocationPolicy
   protected:
     T *data_{nullptr};
 
-    HeapAllocationPolicy() : data_{static_cast<T *>(operator new[](MaxSize * sizeof(T)))}
+    HeapAllocationPolicy()
+        : data_{static_cast<T *>(operator new[](MaxSize * sizeof(T), std::align_val_t{alignof(T)}))}
     {
     }
 
     ~HeapAllocationPolicy()
     {
-        operator delete[](data_);
+        operator delete[](data_, std::align_val_t{alignof(T)});
         data_ = nullptr;
     }
 
@@ -0,0 +1,224 @@
+#ifndef CONTAINERS_HUGE_PAGE_STORAGE_HPP
+#define CONTAINERS_HUGE_PAGE_STORAGE_HPP
+
+#include "cache_line.hpp"
+#include "reserved_pool_allocator.hpp"
+#include "storage_allocation_policy.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace containers
+{
+inline constexpr std::size_t HUGE_PAGE_SIZE = 2U * 1024U * 1024U;
+
+struct HugePageOptions
+{
+    // Touch every page at construction so no page faults happen on first access later on
+    bool prefault{true};
+
+    // Lock the pages into RAM so they are never swapped out, requires a sufficient RLIMIT_MEMLOCK
+    bool lock{false};
+};
+
+enum class PageBacking
+{
+    EXPLICIT_HUGE_PAGES,    // MAP_HUGETLB from the reserved hugetlbfs pool
+    TRANSPARENT_HUGE_PAGES, // 2 MB aligned anonymous mapping with MADV_HUGEPAGE, the kernel decides
+    REGULAR_PAGES           // Heap allocation, huge pages are not available
+};
+
+// Heap storage for large pools that should not take TLB misses and page faults on the hot path. The region is rounded
+// up to a multiple of 2 MB and backed by explicit huge pages if the system has them reserved, otherwise by a 2 MB
+// aligned mapping advised for transparent huge pages, and on other platforms by a plain aligned heap allocation.
+// Locking is best effort: if mlock fails (e.g. because of RLIMIT_MEMLOCK) the storage stays usable and locked()
+// returns false.
+template <typename T, std::size_t MaxSize, HugePageOptions Options> class BasicHugePageStorage
+{
+    static_assert(MaxSize > 0U, "HugePageStorage must contain allocated space for at least 1 element!");
+    static_assert(alignof(T) <= HUGE_PAGE_SIZE, "HugePageStorage cannot satisfy the alignment of T.");
+
+    static constexpr std::size_t BYTES =
+        ((MaxSize * sizeof(T) + HUGE_PAGE_SIZE - 1U) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+
+  public:
+    // Deliberately HeapPolicy: the mapping is owned like HeapStorage's buffer, so the pools accept it in its place
+    using Policy = HeapPolicy;
+
+    // Copy and move operations are deleted to prevent accidental copying
+    BasicHugePageStorage(const BasicHugePageStorage &) = delete;
+    BasicHugePageStorage &operator=(const BasicHugePageStorage &) = delete;
+    BasicHugePageStorage(BasicHugePageStorage &&) noexcept = delete;
+    BasicHugePageStorage &operator=(BasicHugePageStorage &&) noexcept = delete;
+
+    BasicHugePageStorage() : buffer_{nullptr}, backing_{PageBacking::REGULAR_PAGES}, locked_{false}
+    {
+        buffer_ = static_cast<T *>(mapHugePages(backing_));
+        if (nullptr == buffer_)
+        {
+            buffer_ = static_cast<T *>(
+                std::aligned_alloc(alignof(T) > CACHE_LINE_SIZE ? alignof(T) : CACHE_LINE_SIZE, BYTES));
+            if (nullptr == buffer_)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+#if defined(__linux__)
+        if constexpr (Options.lock)
+        {
+            // mlock also faults every page in
+            locked_ = (::mlock(buffer_, BYTES) == 0);
+        }
+#endif
+
+        if constexpr (Options.prefault)
+        {
+            if (!locked_)
+            {
+                prefault();
+            }
+        }
+    }
+
+    ~BasicHugePageStorage()
+    {
+#if defined(__linux__)
+        if (backing_ != PageBacking::REGULAR_PAGES)
+        {
+            ::munmap(buffer_, BYTES);
+            return;
+        }
+
+        if (locked_)
+        {
+            ::munlock(buffer_, BYTES);
+        }
+#endif
+        std::free(buffer_);
+    }
+
+    inline T *buffer() noexcept
+    {
+        return buffer_;
+    }
+
+    inline const T *buffer() const noexcept
+    {
+        return buffer_;
+    }
+
+    inline PageBacking backing() const noexcept
+    {
+        return backing_;
+    }
+
+    inline bool locked() const noexcept
+    {
+        return locked_;
+    }
+
+    // Size of the region including the rounding up to whole huge pages
+    constexpr static inline std::size_t bytes() noexcept
+    {
+        return BYTES;
+    }
+
+  private:
+    static void *mapHugePages(PageBacking &backing) noexcept
+    {
+#if defined(__linux__)
+#if defined(MAP_HUGETLB)
+#if defined(MAP_HUGE_SHIFT)
+        constexpr int HUGE_2MB = 21 << MAP_HUGE_SHIFT;
+#else
+        constexpr int HUGE_2MB = 0;
+#endif
+        void *const explicit_pages = ::mmap(nullptr, BYTES, PROT_READ | PROT_WRITE,
+                                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | HUGE_2MB, -1, 0);
+        if (MAP_FAILED != explicit_pages)
+        {
+            backing = PageBacking::EXPLICIT_HUGE_PAGES;
+            return explicit_pages;
+        }
+#endif
+
+        // Over-allocate by one huge page and trim both ends, so the region starts on a 2 MB boundary and the kernel
+        // can back it with huge pages from the first byte
+        const std::size_t reserved = BYTES + HUGE_PAGE_SIZE;
+        void *const region = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == region)
+        {
+            return nullptr;
+        }
+
+        std::byte *const first = static_cast<std::byte *>(region);
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(first);
+        const std::size_t head = ((HUGE_PAGE_SIZE - (address % HUGE_PAGE_SIZE)) % HUGE_PAGE_SIZE);
+        if (head > 0U)
+        {
+            ::munmap(first, head);
+        }
+        if ((reserved - head - BYTES) > 0U)
+        {
+            ::munmap(first + head + BYTES, reserved - head - BYTES);
+        }
+
+#if defined(MADV_HUGEPAGE)
+        static_cast<void>(::madvise(first + head, BYTES, MADV_HUGEPAGE));
+#endif
+        backing = PageBacking::TRANSPARENT_HUGE_PAGES;
+        return first + head;
+#else
+        static_cast<void>(backing);
+        return nullptr;
+#endif
+    }
+
+    // Writes one byte per base page, so every page is backed by physical memory before first use
+    void prefault() noexcept
+    {
+        std::size_t page_size = 4096U;
+#if defined(__linux__)
+        const long system_page_size = ::sysconf(_SC_PAGESIZE);
+        if (system_page_size > 0)
+        {
+            page_size = static_cast<std::size_t>(system_page_size);
+        }
+#endif
+
+        volatile std::byte *const bytes = static_cast<volatile std::byte *>(static_cast<void *>(buffer_));
+        for (std::size_t offset = 0U; offset < BYTES; offset += page_size)
+        {
+            bytes[offset] = std::byte{0};
+        }
+    }
+
+    T *buffer_;
+    PageBacking backing_;
+    bool locked_;
+};
+
+// Huge pages, pre-faulted at construction
+template <typename T, std::size_t MaxSize>
+using HugePageStorage = BasicHugePageStorage<T, MaxSize, HugePageOptions{true, false}>;
+
+// Huge pages, pre-faulted and locked into RAM
+template <typename T, std::size_t MaxSize>
+using LockedHugePageStorage = BasicHugePageStorage<T, MaxSize, HugePageOptions{true, true}>;
+
+template <typename T, std::size_t MaxSize>
+using HugePageAllocationPolicy = StorageAllocationPolicy<T, MaxSize, HugePageStorage>;
+
+template <typename T, std::size_t MaxSize>
+using LockedHugePageAllocationPolicy = StorageAllocationPolicy<T, MaxSize, LockedHugePageStorage>;
+} // namespace containers
+
+#endif // CONTAINERS_HUGE_PAGE_STORAGE_HPP
@@ -0,0 +1,237 @@
+#ifndef CONTAINERS_MEMORY_RESOURCE_HPP
+#define CONTAINERS_MEMORY_RESOURCE_HPP
+
+#include "cache_line.hpp"
+#include "reserved_pool_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace containers
+{
+// Byte arena of at least MaxBytes bytes on top of StackStorage or HeapStorage, aligned for any fundamental type
+template <std::size_t MaxBytes, template <typename, std::size_t> class StoragePolicy> class ByteArena
+{
+    static constexpr std::size_t BLOCKS = (MaxBytes + sizeof(std::max_align_t) - 1U) / sizeof(std::max_align_t);
+
+    static_assert(std::is_same_v<typename StoragePolicy<std::max_align_t, BLOCKS>::Policy, StackPolicy> ||
+                      std::is_same_v<typename StoragePolicy<std::max_align_t, BLOCKS>::Policy, HeapPolicy>,
+                  "StoragePolicy must be either StackStorage or HeapStorage");
+
+  public:
+    static constexpr std::size_t CAPACITY = BLOCKS * sizeof(std::max_align_t);
+
+    // Returns nullptr if bytes with the given alignment do not fit anymore
+    inline std::byte *bump(const std::size_t bytes, const std::size_t alignment) noexcept
+    {
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(data());
+        const std::uintptr_t aligned = (base + used_ + alignment - 1U) & ~(static_cast<std::uintptr_t>(alignment) - 1U);
+        const std::size_t offset = static_cast<std::size_t>(aligned - base);
+        if ((offset > CAPACITY) || (bytes > (CAPACITY - offset)))
+        {
+            return nullptr;
+        }
+
+        used_ = offset + bytes;
+        return data() + offset;
+    }
+
+    inline void reset() noexcept
+    {
+        used_ = 0U;
+    }
+
+    inline std::size_t used() const noexcept
+    {
+        return used_;
+    }
+
+    inline std::byte *data() noexcept
+    {
+        return static_cast<std::byte *>(static_cast<void *>(storage_.buffer()));
+    }
+
+  private:
+    StoragePolicy<std::max_align_t, BLOCKS> storage_;
+    std::size_t used_{0U};
+};
+
+// Monotonic std::pmr::memory_resource over a fixed arena. Deallocation is a no-op and release() makes the whole arena
+// available again in O(1). Containers using the resource must be destroyed before release() is called. Throws
+// std::bad_alloc when the arena is exhausted instead of falling back to the global heap.
+template <std::size_t MaxBytes, template <typename, std::size_t> class StoragePolicy>
+class MonotonicStorageResource : public std::pmr::memory_resource
+{
+  public:
+    static constexpr std::size_t CAPACITY = ByteArena<MaxBytes, StoragePolicy>::CAPACITY;
+
+    MonotonicStorageResource() = default;
+    ~MonotonicStorageResource() override = default;
+
+    // Containers keep a pointer to the resource, it must not be copied or moved
+    MonotonicStorageResource(const MonotonicStorageResource &) = delete;
+    MonotonicStorageResource &operator=(const MonotonicStorageResource &) = delete;
+    MonotonicStorageResource(MonotonicStorageResource &&) = delete;
+    MonotonicStorageResource &operator=(MonotonicStorageResource &&) = delete;
+
+    inline void release() noexcept
+    {
+        arena_.reset();
+    }
+
+    inline std::size_t used() const noexcept
+    {
+        return arena_.used();
+    }
+
+    constexpr static inline std::size_t capacity() noexcept
+    {
+        return CAPACITY;
+    }
+
+  private:
+    void *do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        std::byte *const p = arena_.bump(bytes, alignment);
+        if (nullptr == p)
+        {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) noexcept override
+    {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return (this == &other);
+    }
+
+    ByteArena<MaxBytes, StoragePolicy> arena_;
+};
+
+// Pooled std::pmr::memory_resource over a fixed arena. Requests are rounded up to power-of-two size classes starting
+// at MIN_BLOCK_SIZE; freed blocks go onto an intrusive free list per class and are reused in O(1), fresh blocks are
+// bumped from the arena. Blocks are aligned to their size up to CACHE_LINE_SIZE, so a recycled block satisfies any
+// alignment up to that; blocks with stricter alignment are bumped and never recycled. release() drops all blocks at
+// once.
+template <std::size_t MaxBytes, template <typename, std::size_t> class StoragePolicy>
+class PooledStorageResource : public std::pmr::memory_resource
+{
+    static constexpr std::size_t MIN_BLOCK_SIZE = 16U;
+    static constexpr std::size_t MAX_BLOCK_ALIGNMENT = CACHE_LINE_SIZE;
+
+  public:
+    static constexpr std::size_t CAPACITY = ByteArena<MaxBytes, StoragePolicy>::CAPACITY;
+
+  private:
+    static constexpr std::size_t CLASS_COUNT = std::bit_width(std::bit_ceil(CAPACITY));
+
+  public:
+    PooledStorageResource() = default;
+    ~PooledStorageResource() override = default;
+
+    // Containers keep a pointer to the resource, it must not be copied or moved
+    PooledStorageResource(const PooledStorageResource &) = delete;
+    PooledStorageResource &operator=(const PooledStorageResource &) = delete;
+    PooledStorageResource(PooledStorageResource &&) = delete;
+    PooledStorageResource &operator=(PooledStorageResource &&) = delete;
+
+    inline void release() noexcept
+    {
+        arena_.reset();
+        free_lists_.fill(nullptr);
+    }
+
+    // Bytes taken from the arena so far, including blocks that sit on free lists
+    inline std::size_t used() const noexcept
+    {
+        return arena_.used();
+    }
+
+    constexpr static inline std::size_t capacity() noexcept
+    {
+        return CAPACITY;
+    }
+
+  private:
+    static constexpr inline std::size_t sizeClass(const std::size_t bytes, const std::size_t alignment) noexcept
+    {
+        return std::bit_width(std::max({bytes, alignment, MIN_BLOCK_SIZE}) - 1U);
+    }
+
+    void *do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        if (alignment > MAX_BLOCK_ALIGNMENT)
+        {
+            std::byte *const p = arena_.bump(bytes, alignment);
+            if (nullptr == p)
+            {
+                throw std::bad_alloc();
+            }
+            return p;
+        }
+
+        const std::size_t size_class = sizeClass(bytes, alignment);
+        if (size_class >= CLASS_COUNT)
+        {
+            throw std::bad_alloc();
+        }
+
+        std::byte *block = free_lists_[size_class];
+        if (nullptr != block)
+        {
+            std::memcpy(static_cast<void *>(&free_lists_[size_class]), static_cast<const void *>(block),
+                        sizeof(std::byte *));
+            return block;
+        }
+
+        const std::size_t block_size = std::size_t{1U} << size_class;
+        block = arena_.bump(block_size, std::min(block_size, MAX_BLOCK_ALIGNMENT));
+        if (nullptr == block)
+        {
+            throw std::bad_alloc();
+        }
+        return block;
+    }
+
+    void do_deallocate(void *p, const std::size_t bytes, const std::size_t alignment) noexcept override
+    {
+        if ((nullptr == p) || (alignment > MAX_BLOCK_ALIGNMENT))
+        {
+            return;
+        }
+
+        const std::size_t size_class = sizeClass(bytes, alignment);
+        std::memcpy(p, static_cast<const void *>(&free_lists_[size_class]), sizeof(std::byte *));
+        free_lists_[size_class] = static_cast<std::byte *>(p);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return (this == &other);
+    }
+
+    ByteArena<MaxBytes, StoragePolicy> arena_;
+    std::array<std::byte *, CLASS_COUNT> free_lists_{};
+};
+
+template <std::size_t MaxBytes> using StackMonotonicResource = MonotonicStorageResource<MaxBytes, StackStorage>;
+
+template <std::size_t MaxBytes> using HeapMonotonicResource = MonotonicStorageResource<MaxBytes, HeapStorage>;
+
+template <std::size_t MaxBytes> using StackPooledResource = PooledStorageResource<MaxBytes, StackStorage>;
+
+template <std::size_t MaxBytes> using HeapPooledResource = PooledStorageResource<MaxBytes, HeapStorage>;
+} // namespace containers
+
+#endif // CONTAINERS_MEMORY_RESOURCE_HPP
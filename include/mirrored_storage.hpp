@@ -0,0 +1,137 @@
+#ifndef CONTAINERS_MIRRORED_STORAGE_HPP
+#define CONTAINERS_MIRRORED_STORAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace containers
+{
+struct MirroredPolicy
+{
+};
+
+// Storage for ring buffers whose memory is mapped twice back to back, so that buffer()[i] and buffer()[i + MaxSize]
+// refer to the same element and any region of up to MaxSize elements is contiguous, even across the wrap point.
+// Mirroring requires Linux and a storage size that is a multiple of the page size. In any other case the storage
+// falls back to a single aligned heap allocation and mirrored() returns false.
+template <typename T, std::size_t MaxSize> class MirroredStorage
+{
+    static_assert(MaxSize > 0U, "MirroredStorage must contain allocated space for at least 1 element!");
+    static_assert(std::is_trivially_copyable_v<T>, "MirroredStorage is only valid for trivially copyable types, "
+                                                   "which can be accessed at both mappings.");
+
+    static constexpr std::size_t BYTES = MaxSize * sizeof(T);
+
+  public:
+    using Policy = MirroredPolicy;
+
+    // Copy and move operations are deleted to prevent accidental copying
+    MirroredStorage(const MirroredStorage &) = delete;
+    MirroredStorage &operator=(const MirroredStorage &) = delete;
+    MirroredStorage(MirroredStorage &&) noexcept = delete;
+    MirroredStorage &operator=(MirroredStorage &&) noexcept = delete;
+
+    MirroredStorage() : buffer_{mapMirrored()}, mirrored_{nullptr != buffer_}
+    {
+        if (!mirrored_)
+        {
+            buffer_ = static_cast<T *>(std::aligned_alloc(alignof(T), BYTES));
+            if (nullptr == buffer_)
+            {
+                throw std::bad_alloc();
+            }
+        }
+    }
+
+    ~MirroredStorage()
+    {
+#if defined(__linux__)
+        if (mirrored_)
+        {
+            ::munmap(buffer_, 2U * BYTES);
+            return;
+        }
+#endif
+        std::free(buffer_);
+    }
+
+    inline T *buffer() noexcept
+    {
+        return buffer_;
+    }
+
+    inline const T *buffer() const noexcept
+    {
+        return buffer_;
+    }
+
+    // True if the second mapping exists, false if the storage fell back to a plain heap allocation
+    inline bool mirrored() const noexcept
+    {
+        return mirrored_;
+    }
+
+  private:
+    static T *mapMirrored() noexcept
+    {
+#if defined(__linux__)
+        const long page_size = ::sysconf(_SC_PAGESIZE);
+        if ((page_size <= 0) || ((BYTES % static_cast<std::size_t>(page_size)) != 0U))
+        {
+            return nullptr;
+        }
+
+        const int fd = ::memfd_create("containers_mirrored_storage", MFD_CLOEXEC);
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(BYTES)) != 0)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        // Reserve address space for both mappings, then map the same file over each half
+        void *const region = ::mmap(nullptr, 2U * BYTES, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == region)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        std::byte *const first = static_cast<std::byte *>(region);
+        const bool mapped =
+            (MAP_FAILED != ::mmap(first, BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)) &&
+            (MAP_FAILED != ::mmap(first + BYTES, BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0));
+
+        // The mappings keep the memory alive
+        ::close(fd);
+
+        if (!mapped)
+        {
+            ::munmap(region, 2U * BYTES);
+            return nullptr;
+        }
+
+        return static_cast<T *>(region);
+#else
+        return nullptr;
+#endif
+    }
+
+    T *buffer_;
+    bool mirrored_;
+};
+} // namespace containers
+
+#endif // CONTAINERS_MIRRORED_STORAGE_HPP
@@ -0,0 +1,269 @@
+#ifndef CONTAINERS_MPMC_CIRCULAR_BUFFER_HPP
+#define CONTAINERS_MPMC_CIRCULAR_BUFFER_HPP
+
+#include "cache_line.hpp"
+#include "circular_buffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Bounded lock-free circular buffer for any number of producer and consumer threads (Dmitry Vyukov's design).
+// Every slot carries a sequence number that tells whether it is ready to be written for the current lap of the
+// ring or ready to be read, so producers only contend on the enqueue position and consumers on the dequeue position.
+template <typename T, std::size_t Size> class MpmcCircularBuffer
+{
+    static_assert(((Size & (Size - 1U)) == 0U), "MpmcCircularBuffer's Size must be a power of 2.");
+    static_assert((Size > 0U), "MpmcCircularBuffer must have non-zero size.");
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>,
+                  "MpmcCircularBuffer requires T to be nothrow move constructible and nothrow destructible.");
+
+    static constexpr std::size_t SIZE = Size;
+    static constexpr std::size_t LAST_INDEX = SIZE - 1U;
+
+  public:
+    using value_type = T;
+
+    // Default constructor
+    MpmcCircularBuffer(OverflowBehaviour behaviour = OverflowBehaviour::THROW_EXCEPTION) noexcept
+        : overflow_behaviour_{behaviour}
+    {
+        for (std::size_t i = 0U; i < SIZE; ++i)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Destructor
+    ~MpmcCircularBuffer()
+    {
+        while (try_consume([](T &) noexcept {}))
+        {
+        }
+    }
+
+    // The positions are shared with other threads, the buffer must not be copied or moved
+    MpmcCircularBuffer(const MpmcCircularBuffer &) = delete;
+    MpmcCircularBuffer &operator=(const MpmcCircularBuffer &) = delete;
+    MpmcCircularBuffer(MpmcCircularBuffer &&) = delete;
+    MpmcCircularBuffer &operator=(MpmcCircularBuffer &&) = delete;
+
+    template <typename U> void push(U &&value)
+    {
+        emplace(std::forward<U>(value));
+    }
+
+    template <typename U> bool try_push(U &&value) noexcept(std::is_nothrow_constructible_v<T, U &&>)
+    {
+        return try_emplace(std::forward<U>(value));
+    }
+
+    // With OVERFLOW_OLDEST the producer evicts the oldest element and retries. Under contention the evicted element
+    // is the oldest one at the time of the eviction, not necessarily the oldest one at the time of the call.
+    template <typename... Args> void emplace(Args &&...args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+        {
+            emplaceOrEvict(std::forward<Args>(args)...);
+        }
+        else
+        {
+            T element{std::forward<Args>(args)...};
+            emplaceOrEvict(std::move(element));
+        }
+    }
+
+    // A constructor that may throw runs before a slot is claimed, so an exception leaves the buffer unchanged
+    template <typename... Args>
+    bool try_emplace(Args &&...args) noexcept(std::is_nothrow_constructible_v<T, Args &&...>)
+    {
+        if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+        {
+            return tryConstruct(std::forward<Args>(args)...);
+        }
+        else
+        {
+            T element{std::forward<Args>(args)...};
+            return tryConstruct(std::move(element));
+        }
+    }
+
+    T pop()
+    {
+        std::optional<T> value;
+
+        if (!try_consume([&value](T &element) { value.emplace(std::move(element)); }))
+        {
+            throw std::runtime_error("Buffer is empty.");
+        }
+
+        return std::move(*value);
+    }
+
+    bool try_pop(T &out_value) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        return try_consume([&out_value](T &element) { out_value = std::move(element); });
+    }
+
+    // Approximate when other threads are pushing or popping concurrently
+    inline std::size_t size() const noexcept
+    {
+        const std::size_t dequeue_position = dequeue_position_.value.load(std::memory_order_acquire);
+        const std::size_t enqueue_position = enqueue_position_.value.load(std::memory_order_acquire);
+        return (enqueue_position > dequeue_position) ? (enqueue_position - dequeue_position) : 0U;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (size() == 0U);
+    }
+
+    inline bool full() const noexcept
+    {
+        return (size() >= SIZE);
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(alignof(T)) std::byte storage[sizeof(T)];
+
+        inline T *element() noexcept
+        {
+            return static_cast<T *>(static_cast<void *>(storage));
+        }
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Position
+    {
+        std::atomic<std::size_t> value{0U};
+    };
+
+    // Arguments are only forwarded once a slot has been claimed, so retrying does not consume them
+    template <typename... Args> void emplaceOrEvict(Args &&...args)
+    {
+        while (!tryConstruct(std::forward<Args>(args)...))
+        {
+            if (OverflowBehaviour::THROW_EXCEPTION == overflow_behaviour_)
+            {
+                throw std::runtime_error("MpmcCircularBuffer is full.");
+            }
+
+            // Overwrite the oldest element
+            try_consume([](T &) noexcept {});
+        }
+    }
+
+    // Only called with arguments T is nothrow constructible from, a claimed slot must always be published
+    template <typename... Args> bool tryConstruct(Args &&...args) noexcept
+    {
+        Cell *cell;
+        std::size_t position = enqueue_position_.value.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &cells_[position & LAST_INDEX];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (difference == 0)
+            {
+                // Slot is free for this lap, try to claim it
+                if (enqueue_position_.value.compare_exchange_weak(position, position + 1U,
+                                                                  std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Slot still holds the element from the previous lap, buffer is full
+                return false;
+            }
+            else
+            {
+                // Another producer claimed the slot, reload the position
+                position = enqueue_position_.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (cell->element()) T{std::forward<Args>(args)...};
+        cell->sequence.store(position + 1U, std::memory_order_release);
+
+        // Successfully emplaced
+        return true;
+    }
+
+    // If the consumer throws, the element is still destroyed and the slot released, so the element is lost
+    template <typename Consumer>
+    bool try_consume(Consumer &&consumer) noexcept(std::is_nothrow_invocable_v<Consumer &, T &>)
+    {
+        Cell *cell;
+        std::size_t position = dequeue_position_.value.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &cells_[position & LAST_INDEX];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1U);
+
+            if (difference == 0)
+            {
+                // Slot holds an element for this lap, try to claim it
+                if (dequeue_position_.value.compare_exchange_weak(position, position + 1U,
+                                                                  std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Slot has not been written yet, buffer is empty
+                return false;
+            }
+            else
+            {
+                // Another consumer claimed the slot, reload the position
+                position = dequeue_position_.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        struct Release
+        {
+            Cell *cell;
+            std::size_t sequence;
+
+            ~Release()
+            {
+                cell->element()->~T();
+
+                // Release the slot to the producers of the next lap
+                cell->sequence.store(sequence, std::memory_order_release);
+            }
+        };
+
+        const Release release{cell, position + SIZE};
+        consumer(*cell->element());
+
+        // Successfully consumed
+        return true;
+    }
+
+    Position enqueue_position_;
+    Position dequeue_position_;
+    alignas(CACHE_LINE_SIZE) Cell cells_[SIZE];
+
+    // Behaviour when the buffer is full
+    OverflowBehaviour overflow_behaviour_;
+};
+} // namespace containers
+
+#endif // CONTAINERS_MPMC_CIRCULAR_BUFFER_HPP
@@ -0,0 +1,319 @@
+#ifndef CONTAINERS_NUMA_STORAGE_HPP
+#define CONTAINERS_NUMA_STORAGE_HPP
+
+#include "cache_line.hpp"
+#include "reserved_pool_allocator.hpp"
+#include "storage_allocation_policy.hpp"
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace containers
+{
+// Bind to the node of the thread that constructs the storage
+inline constexpr int NUMA_LOCAL_NODE = -1;
+
+// Spread the pages round-robin over all online nodes
+inline constexpr int NUMA_INTERLEAVED = -2;
+
+// Thin wrappers around the Linux NUMA syscalls, so no libnuma is needed. On other platforms, or when the kernel
+// refuses the calls (e.g. inside containers without CAP_SYS_NICE), the machine is treated as a single node.
+namespace numa
+{
+inline constexpr int MAX_NODES = 1024;
+
+using NodeMask = std::array<unsigned long, MAX_NODES / (CHAR_BIT * sizeof(unsigned long))>;
+
+// Parses a sysfs node list such as "0", "0-3" or "0,2-3" into a mask, returns the number of nodes in it
+inline int parseNodeList(const char *list, NodeMask &mask) noexcept
+{
+    int count = 0;
+    const char *position = list;
+    while ((*position >= '0') && (*position <= '9'))
+    {
+        char *end = nullptr;
+        const long first = std::strtol(position, &end, 10);
+        long last = first;
+        if (*end == '-')
+        {
+            last = std::strtol(end + 1, &end, 10);
+        }
+
+        for (long node = first; (node <= last) && (node < MAX_NODES); ++node)
+        {
+            constexpr long BITS = static_cast<long>(CHAR_BIT * sizeof(unsigned long));
+            mask[static_cast<std::size_t>(node / BITS)] |= (1UL << static_cast<unsigned long>(node % BITS));
+            ++count;
+        }
+
+        position = (*end == ',') ? (end + 1) : end;
+    }
+    return count;
+}
+
+// Mask of the online nodes, returns the number of online nodes (at least 1)
+inline int onlineNodes(NodeMask &mask) noexcept
+{
+    mask = NodeMask{};
+    int count = 0;
+
+#if defined(__linux__)
+    if (std::FILE *const file = std::fopen("/sys/devices/system/node/online", "r"))
+    {
+        char list[256] = {};
+        if (nullptr != std::fgets(list, sizeof(list), file))
+        {
+            count = parseNodeList(list, mask);
+        }
+        std::fclose(file);
+    }
+#endif
+
+    if (count == 0)
+    {
+        mask[0] = 1UL;
+        count = 1;
+    }
+    return count;
+}
+
+inline int nodeCount() noexcept
+{
+    NodeMask mask;
+    return onlineNodes(mask);
+}
+
+// Node of the CPU the calling thread currently runs on
+inline int currentNode() noexcept
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0U;
+    unsigned node = 0U;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+    {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+// Applies a binding or interleaving policy to [address, address + bytes), moving pages that are already faulted in.
+// Returns false if the kernel does not support it.
+inline bool bind(void *address, const std::size_t bytes, const int node) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    NodeMask mask{};
+    int mode = MPOL_BIND;
+    if (node == NUMA_INTERLEAVED)
+    {
+        onlineNodes(mask);
+        mode = MPOL_INTERLEAVE;
+    }
+    else if ((node >= 0) && (node < MAX_NODES))
+    {
+        constexpr int BITS = static_cast<int>(CHAR_BIT * sizeof(unsigned long));
+        mask[static_cast<std::size_t>(node / BITS)] = (1UL << static_cast<unsigned>(node % BITS));
+    }
+    else
+    {
+        return false;
+    }
+
+    return (::syscall(SYS_mbind, address, bytes, mode, mask.data(), static_cast<unsigned long>(MAX_NODES + 1),
+                      MPOL_MF_MOVE) == 0);
+#else
+    static_cast<void>(address);
+    static_cast<void>(bytes);
+    static_cast<void>(node);
+    return false;
+#endif
+}
+} // namespace numa
+
+// Heap storage whose pages are placed on one NUMA node, or interleaved over all nodes. Node is used by the default
+// constructor; NUMA_LOCAL_NODE resolves to the node of the constructing thread. Memory is mapped, bound and then
+// prefaulted, all from the constructing thread, so the owning thread should construct the storage. Storage that
+// ends up owned by another thread can be moved with bindToCallingThread().
+template <typename T, std::size_t MaxSize, int Node> class BasicNumaStorage
+{
+    static_assert(MaxSize > 0U, "NumaStorage must contain allocated space for at least 1 element!");
+
+    static constexpr std::size_t MIN_BYTES = MaxSize * sizeof(T);
+
+    // Assumed where the page size cannot be queried
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 4096U;
+
+  public:
+    // Deliberately HeapPolicy, so the pools accept NUMA storage wherever they accept HeapStorage
+    using Policy = HeapPolicy;
+
+    // Copy and move operations are deleted to prevent accidental copying
+    BasicNumaStorage(const BasicNumaStorage &) = delete;
+    BasicNumaStorage &operator=(const BasicNumaStorage &) = delete;
+    BasicNumaStorage(BasicNumaStorage &&) noexcept = delete;
+    BasicNumaStorage &operator=(BasicNumaStorage &&) noexcept = delete;
+
+    BasicNumaStorage() : BasicNumaStorage{Node}
+    {
+    }
+
+    // node is a node id, NUMA_LOCAL_NODE or NUMA_INTERLEAVED
+    explicit BasicNumaStorage(const int node)
+        : buffer_{nullptr}, bytes_{MIN_BYTES}, page_size_{DEFAULT_PAGE_SIZE}, node_{0}, bound_{false}, mapped_{false}
+    {
+#if defined(__linux__)
+        const long page_size = ::sysconf(_SC_PAGESIZE);
+        if (page_size > 0)
+        {
+            page_size_ = static_cast<std::size_t>(page_size);
+        }
+        bytes_ = ((MIN_BYTES + page_size_ - 1U) / page_size_) * page_size_;
+
+        void *const region = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED != region)
+        {
+            buffer_ = static_cast<T *>(region);
+            mapped_ = true;
+        }
+#endif
+
+        if (nullptr == buffer_)
+        {
+            bytes_ = MIN_BYTES;
+            buffer_ = static_cast<T *>(std::aligned_alloc(alignof(T), bytes_));
+            if (nullptr == buffer_)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+        bindTo((node == NUMA_LOCAL_NODE) ? numa::currentNode() : node);
+    }
+
+    ~BasicNumaStorage()
+    {
+#if defined(__linux__)
+        if (mapped_)
+        {
+            ::munmap(buffer_, bytes_);
+            return;
+        }
+#endif
+        std::free(buffer_);
+    }
+
+    // Moves the pages to the node of the calling thread and faults in any that are still missing
+    inline void bindToCallingThread() noexcept
+    {
+        bindTo(numa::currentNode());
+    }
+
+    inline T *buffer() noexcept
+    {
+        return buffer_;
+    }
+
+    inline const T *buffer() const noexcept
+    {
+        return buffer_;
+    }
+
+    // Node the pages are bound to, NUMA_INTERLEAVED, or the requested node if binding is not supported
+    inline int node() const noexcept
+    {
+        return node_;
+    }
+
+    // False if the kernel did not accept the policy, e.g. on single-node or non-Linux systems
+    inline bool bound() const noexcept
+    {
+        return bound_;
+    }
+
+  private:
+    void bindTo(const int node) noexcept
+    {
+        node_ = node;
+        bound_ = mapped_ && numa::bind(buffer_, bytes_, node);
+        prefault();
+    }
+
+    // Writes one byte per page, so every page is allocated under the node policy
+    void prefault() noexcept
+    {
+        volatile std::byte *const bytes = static_cast<volatile std::byte *>(static_cast<void *>(buffer_));
+        for (std::size_t offset = 0U; offset < bytes_; offset += page_size_)
+        {
+            bytes[offset] = bytes[offset];
+        }
+    }
+
+    T *buffer_;
+    std::size_t bytes_;
+    std::size_t page_size_;
+    int node_;
+    bool bound_;
+    bool mapped_;
+};
+
+// Bound to the node of the constructing thread
+template <typename T, std::size_t MaxSize> using NumaLocalStorage = BasicNumaStorage<T, MaxSize, NUMA_LOCAL_NODE>;
+
+// Interleaved over all online nodes
+template <typename T, std::size_t MaxSize>
+using NumaInterleavedStorage = BasicNumaStorage<T, MaxSize, NUMA_INTERLEAVED>;
+
+template <typename T, std::size_t MaxSize, int Node> class BasicNumaAllocationPolicy;
+
+// Binds to a fixed node, e.g. NumaNode<1>::Storage or GenericVector<T, N, NumaNode<1>::AllocationPolicy>
+template <int Node> struct NumaNode
+{
+    template <typename T, std::size_t MaxSize> using Storage = BasicNumaStorage<T, MaxSize, Node>;
+
+    template <typename T, std::size_t MaxSize> using AllocationPolicy = BasicNumaAllocationPolicy<T, MaxSize, Node>;
+};
+
+// GenericVector allocation policy over BasicNumaStorage. The node and the migration are part of the container's
+// public interface.
+template <typename T, std::size_t MaxSize, int Node>
+class BasicNumaAllocationPolicy : public StorageAllocationPolicy<T, MaxSize, NumaNode<Node>::template Storage>
+{
+    using Base = StorageAllocationPolicy<T, MaxSize, NumaNode<Node>::template Storage>;
+
+  public:
+    inline int numaNode() const noexcept
+    {
+        return Base::storage().node();
+    }
+
+    // Moves the elements' pages to the node of the calling thread, e.g. after handing the container to a pinned worker
+    inline void bindToCallingThread() noexcept
+    {
+        Base::storage().bindToCallingThread();
+    }
+
+  protected:
+    BasicNumaAllocationPolicy() = default;
+    ~BasicNumaAllocationPolicy() = default;
+};
+
+template <typename T, std::size_t MaxSize>
+using NumaLocalAllocationPolicy = BasicNumaAllocationPolicy<T, MaxSize, NUMA_LOCAL_NODE>;
+
+template <typename T, std::size_t MaxSize>
+using NumaInterleavedAllocationPolicy = BasicNumaAllocationPolicy<T, MaxSize, NUMA_INTERLEAVED>;
+} // namespace containers
+
+#endif // CONTAINERS_NUMA_STORAGE_HPP
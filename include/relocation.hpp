@@ -0,0 +1,93 @@
+#ifndef CONTAINERS_RELOCATION_HPP
+#define CONTAINERS_RELOCATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace containers
+{
+// A type is trivially relocatable if moving an object to a new address and ending the lifetime of the original is
+// equivalent to copying its bytes. Every trivially copyable type is; other types (e.g. ones that own a heap pointer but
+// never point into themselves) can opt in by specialising this trait:
+//
+//     template <> struct containers::is_trivially_relocatable<MyType> : std::true_type {};
+template <typename T> struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+template <typename T> inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Copy-constructs count elements into uninitialised memory
+template <typename T> inline void uninitializedCopy(const T *source, const std::size_t count, T *destination)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (count > 0U)
+        {
+            std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(T));
+        }
+    }
+    else
+    {
+        std::uninitialized_copy_n(source, count, destination);
+    }
+}
+
+// Moves count elements into uninitialised memory and ends the lifetime of the source elements
+template <typename T> inline void uninitializedRelocate(T *source, const std::size_t count, T *destination)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        if (count > 0U)
+        {
+            std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(T));
+        }
+    }
+    else
+    {
+        std::uninitialized_move_n(source, count, destination);
+        std::destroy_n(source, count);
+    }
+}
+
+template <typename T> inline void destroyElements(T *first, const std::size_t count) noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        std::destroy_n(first, count);
+    }
+}
+
+// Swaps the contents of two arrays that hold lhs_count and rhs_count constructed elements and have room for at least
+// max(lhs_count, rhs_count) elements each
+template <typename T>
+inline void swapElements(T *lhs, const std::size_t lhs_count, T *rhs, const std::size_t rhs_count)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        std::byte *const lhs_bytes = static_cast<std::byte *>(static_cast<void *>(lhs));
+        std::byte *const rhs_bytes = static_cast<std::byte *>(static_cast<void *>(rhs));
+        std::swap_ranges(lhs_bytes, lhs_bytes + (std::max(lhs_count, rhs_count) * sizeof(T)), rhs_bytes);
+    }
+    else
+    {
+        const std::size_t common_count = std::min(lhs_count, rhs_count);
+        std::swap_ranges(lhs, lhs + common_count, rhs);
+
+        if (lhs_count > common_count)
+        {
+            uninitializedRelocate(lhs + common_count, lhs_count - common_count, rhs + common_count);
+        }
+        else
+        {
+            uninitializedRelocate(rhs + common_count, rhs_count - common_count, lhs + common_count);
+        }
+    }
+}
+} // namespace containers
+
+#endif // CONTAINERS_RELOCATION_HPP
@@ -1,12 +1,19 @@
 #ifndef CONTAINERS_POOL_ALLOCATOR
 #define CONTAINERS_POOL_ALLOCATOR
 
+#include "allocation_stats.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <new>
 #include <type_traits>
+#include <utility>
 
 namespace containers
 {
@@ -18,6 +25,16 @@ struct HeapPolicy
 {
 };
 
+// Deallocation is a no-op, memory is only handed out once (monotonic bump allocation)
+struct NoRecycling
+{
+};
+
+// Freed blocks are kept in intrusive free lists, one per power-of-two size class, and handed out again
+struct FreeListRecycling
+{
+};
+
 template <typename T, std::size_t MaxSize> class StackStorage
 {
     static_assert(MaxSize > 0U, "StackStorage must contain allocated space for at least 1 element!");
@@ -41,7 +58,7 @@ template <typename T, std::size_t MaxSize> class StackStorage
 
     constexpr inline const T *buffer() const noexcept
     {
-        return static_cast<T *>(static_cast<void *>(buffer_));
+        return static_cast<const T *>(static_cast<const void *>(buffer_));
     }
 
   private:
@@ -90,12 +107,30 @@ template <typename T, std::size_t MaxSize> class HeapStorage
     T *buffer_;
 };
 
-template <typename T, std::size_t MaxSize, template <typename, std::size_t> class StoragePolicy>
+// With FreeListRecycling, a freed block of n elements is pushed onto the free list of size class floor(log2(n)), so
+// every block in class k holds at least 2^k elements. A request for n elements pops from class ceil(log2(n)) in O(1),
+// otherwise it bumps fresh memory, and only when the pool is exhausted it takes a block from a larger class. A free
+// block stores the pointer to the next free block in its own memory, so recycled blocks span at least
+// MIN_BLOCK_SIZE elements.
+//
+// StatsPolicy (see allocation_stats.hpp) records usage, peaks, failures and a request size histogram. Allocators inside
+// standard containers are out of reach, use SharedStats<Tag> to read their stats with sharedPoolStats<Tag>().
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class StoragePolicy,
+          typename RecyclingPolicy = NoRecycling, typename StatsPolicy = NoStats>
 class ReservedPoolAllocator
 {
     static_assert(std::is_same_v<typename StoragePolicy<T, MaxSize>::Policy, StackPolicy> ||
                       std::is_same_v<typename StoragePolicy<T, MaxSize>::Policy, HeapPolicy>,
                   "StoragePolicy must be either StackStorage or HeapStorage");
+    static_assert(std::is_same_v<RecyclingPolicy, NoRecycling> || std::is_same_v<RecyclingPolicy, FreeListRecycling>,
+                  "RecyclingPolicy must be either NoRecycling or FreeListRecycling");
+
+    static constexpr bool RECYCLING = std::is_same_v<RecyclingPolicy, FreeListRecycling>;
+    static constexpr std::size_t MIN_BLOCK_SIZE = std::bit_ceil((sizeof(T *) + sizeof(T) - 1U) / sizeof(T));
+    static constexpr std::size_t CLASS_COUNT = RECYCLING ? std::bit_width(std::bit_ceil(MaxSize)) : 0U;
+
+    static_assert(!RECYCLING || (MaxSize >= MIN_BLOCK_SIZE),
+                  "FreeListRecycling requires room for at least one pointer-sized block");
 
   public:
     using size_type = std::size_t;
@@ -106,30 +141,101 @@ class ReservedPoolAllocator
     using const_reference = const T &;
     using value_type = T;
 
-    constexpr ReservedPoolAllocator() : storage_{}, used_{0U}
+    constexpr ReservedPoolAllocator() : storage_{}, used_{0U}, free_lists_{}
+    {
+    }
+
+    ~ReservedPoolAllocator() = default;
+
+    // Shared stats outlive the pool, so its memory is handed back to them
+    ~ReservedPoolAllocator()
+        requires(PoolStatsRecorder<StatsPolicy>::SHARED)
     {
+        stats_.onRelease(used_ * sizeof(T), freeBlockCount());
     }
 
     template <typename U> struct rebind
     {
-        using other = ReservedPoolAllocator<U, MaxSize, StoragePolicy>;
+        using other = ReservedPoolAllocator<U, MaxSize, StoragePolicy, RecyclingPolicy, StatsPolicy>;
     };
 
+    // Snapshot of the usage counters, safe to call from any thread
+    PoolStatsSnapshot stats() const noexcept
+        requires(PoolStatsRecorder<StatsPolicy>::ENABLED)
+    {
+        return stats_.snapshot();
+    }
+
     T *allocate(const std::size_t n)
     {
-        if ((used_ + n) > MaxSize)
+        if constexpr (RECYCLING)
         {
+            const std::size_t size = std::max(n, MIN_BLOCK_SIZE);
+
+            // Smallest class whose blocks are guaranteed to hold size elements
+            const std::size_t fit_class = std::bit_width(size - 1U);
+            if ((fit_class < CLASS_COUNT) && (nullptr != free_lists_[fit_class]))
+            {
+                stats_.onAllocate(n * sizeof(T));
+                return popFreeBlock(fit_class);
+            }
+
+            if ((used_ + size) <= MaxSize)
+            {
+                stats_.onAllocate(n * sizeof(T));
+                return bump(size);
+            }
+
+            // Pool is exhausted, fall back to a larger recycled block
+            for (std::size_t size_class = fit_class + 1U; size_class < CLASS_COUNT; ++size_class)
+            {
+                if (nullptr != free_lists_[size_class])
+                {
+                    stats_.onAllocate(n * sizeof(T));
+                    return popFreeBlock(size_class);
+                }
+            }
+
+            stats_.onFailure(n * sizeof(T));
             throw std::bad_alloc();
         }
+        else
+        {
+            if ((used_ + n) > MaxSize)
+            {
+                stats_.onFailure(n * sizeof(T));
+                throw std::bad_alloc();
+            }
 
-        T *result = storage_.buffer() + static_cast<std::ptrdiff_t>(used_);
-        used_ += n;
-        return result;
+            stats_.onAllocate(n * sizeof(T));
+            return bump(n);
+        }
     }
 
-    constexpr void deallocate(T * /* p */, std::size_t /* n */)
+    constexpr void deallocate(T *p, std::size_t n)
     {
-        // Deallocate method is a no-op for both stack and heap in this design
+        if (nullptr != p)
+        {
+            stats_.onDeallocate(n * sizeof(T));
+        }
+
+        if constexpr (RECYCLING)
+        {
+            if (nullptr == p)
+            {
+                return;
+            }
+
+            // Largest class whose blocks are guaranteed to fit into this block
+            const std::size_t size_class = std::bit_width(std::max(n, MIN_BLOCK_SIZE)) - 1U;
+            pushFreeBlock(size_class, p);
+        }
+        else
+        {
+            // Deallocate method is a no-op for both stack and heap in this design
+            static_cast<void>(p);
+            static_cast<void>(n);
+        }
     }
 
     template <typename U> inline void construct(pointer p, U &&value)
@@ -143,8 +249,58 @@ class ReservedPoolAllocator
     }
 
   private:
+    struct NoFreeLists
+    {
+    };
+
+    using FreeLists = std::conditional_t<RECYCLING, std::array<T *, CLASS_COUNT>, NoFreeLists>;
+
+    inline T *bump(const std::size_t n) noexcept
+    {
+        T *result = storage_.buffer() + static_cast<std::ptrdiff_t>(used_);
+        used_ += n;
+        stats_.onBump(n * sizeof(T), used_ * sizeof(T));
+        return result;
+    }
+
+    // The link is copied byte-wise because the block is only aligned for T
+    inline T *popFreeBlock(const std::size_t size_class) noexcept
+    {
+        T *const block = free_lists_[size_class];
+        std::memcpy(static_cast<void *>(&free_lists_[size_class]), static_cast<const void *>(block), sizeof(T *));
+        stats_.onFreeListPop();
+        return block;
+    }
+
+    inline void pushFreeBlock(const std::size_t size_class, T *block) noexcept
+    {
+        std::memcpy(static_cast<void *>(block), static_cast<const void *>(&free_lists_[size_class]), sizeof(T *));
+        free_lists_[size_class] = block;
+        stats_.onFreeListPush();
+    }
+
+    // Walks the free lists, only needed to hand the blocks back to shared stats
+    std::size_t freeBlockCount() const noexcept
+    {
+        std::size_t count = 0U;
+        if constexpr (RECYCLING)
+        {
+            for (T *block : free_lists_)
+            {
+                while (nullptr != block)
+                {
+                    ++count;
+                    std::memcpy(static_cast<void *>(&block), static_cast<const void *>(block), sizeof(T *));
+                }
+            }
+        }
+        return count;
+    }
+
     StoragePolicy<T, MaxSize> storage_;
     std::size_t used_;
+    [[no_unique_address]] FreeLists free_lists_;
+    [[no_unique_address]] PoolStatsRecorder<StatsPolicy> stats_;
 };
 
 } // namespace containers
@@ -0,0 +1,128 @@
+#ifndef CONTAINERS_RING_ITERATOR_HPP
+#define CONTAINERS_RING_ITERATOR_HPP
+
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace containers
+{
+// Random-access iterator over a power-of-two ring buffer in logical order, starting at the slot head. The iterator
+// keeps a logical position, so comparisons and distances never see the wrap-around and only dereferencing masks the
+// physical index. Constant iterators use a const T.
+template <typename T, std::size_t Size> class RingIterator
+{
+    static_assert(std::has_single_bit(Size), "RingIterator's Size must be a power of 2.");
+
+    static constexpr std::size_t MASK = Size - 1U;
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    RingIterator() noexcept = default;
+
+    RingIterator(T *buffer, const std::size_t head, const std::size_t position) noexcept
+        : buffer_{buffer}, head_{head}, position_{position}
+    {
+    }
+
+    // A mutable iterator converts to a constant one
+    template <typename U>
+        requires(std::is_const_v<T> && std::is_same_v<const U, T>)
+    RingIterator(const RingIterator<U, Size> &other) noexcept
+        : buffer_{other.buffer_}, head_{other.head_}, position_{other.position_}
+    {
+    }
+
+    inline reference operator*() const noexcept
+    {
+        return buffer_[(head_ + position_) & MASK];
+    }
+
+    inline pointer operator->() const noexcept
+    {
+        return &buffer_[(head_ + position_) & MASK];
+    }
+
+    inline reference operator[](const difference_type n) const noexcept
+    {
+        return buffer_[(head_ + position_ + static_cast<std::size_t>(n)) & MASK];
+    }
+
+    // Arithmetic operations
+    inline RingIterator &operator++() noexcept
+    {
+        ++position_;
+        return *this;
+    }
+    inline RingIterator operator++(int) noexcept
+    {
+        RingIterator temp = *this;
+        ++position_;
+        return temp;
+    }
+    inline RingIterator &operator--() noexcept
+    {
+        --position_;
+        return *this;
+    }
+    inline RingIterator operator--(int) noexcept
+    {
+        RingIterator temp = *this;
+        --position_;
+        return temp;
+    }
+    inline RingIterator &operator+=(const difference_type n) noexcept
+    {
+        position_ += static_cast<std::size_t>(n);
+        return *this;
+    }
+    inline RingIterator &operator-=(const difference_type n) noexcept
+    {
+        position_ -= static_cast<std::size_t>(n);
+        return *this;
+    }
+    inline RingIterator operator+(const difference_type n) const noexcept
+    {
+        return RingIterator{buffer_, head_, position_ + static_cast<std::size_t>(n)};
+    }
+    inline friend RingIterator operator+(const difference_type n, const RingIterator &it) noexcept
+    {
+        return (it + n);
+    }
+    inline RingIterator operator-(const difference_type n) const noexcept
+    {
+        return RingIterator{buffer_, head_, position_ - static_cast<std::size_t>(n)};
+    }
+    inline difference_type operator-(const RingIterator &other) const noexcept
+    {
+        return static_cast<difference_type>(position_ - other.position_);
+    }
+
+    // Comparison operators, only meaningful between iterators of the same buffer
+    inline friend bool operator==(const RingIterator &a, const RingIterator &b) noexcept
+    {
+        return (a.position_ == b.position_);
+    }
+    inline friend std::strong_ordering operator<=>(const RingIterator &a, const RingIterator &b) noexcept
+    {
+        return (a.position_ <=> b.position_);
+    }
+
+  private:
+    template <typename, std::size_t> friend class RingIterator;
+
+    T *buffer_{nullptr};
+    std::size_t head_{0U};
+    std::size_t position_{0U};
+};
+} // namespace containers
+
+#endif // CONTAINERS_RING_ITERATOR_HPP
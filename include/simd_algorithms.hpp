@@ -0,0 +1,1371 @@
+#ifndef CONTAINERS_SIMD_ALGORITHMS_HPP
+#define CONTAINERS_SIMD_ALGORITHMS_HPP
+
+#include "generic_vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CONTAINERS_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// The vector types carry alignment attributes that are irrelevant when they are only used to select a type
+#if defined(CONTAINERS_SIMD_X86)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace containers
+{
+// Search, count, fill, min/max and equality over contiguous arithmetic arrays. The vector code is compiled for SSE2,
+// AVX2 and AVX-512 side by side and the widest level the CPU supports is picked at runtime. 32- and 64-bit integers,
+// float and double are vectorised, all other arithmetic types use the scalar loops. Floating point comparisons follow
+// the scalar operators (NaN never compares equal, -0.0 == 0.0); min and max are unspecified if the data contains NaNs.
+namespace simd
+{
+enum class Isa
+{
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+template <typename T>
+inline constexpr bool IS_VECTORISABLE = (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                                         ((sizeof(T) == 4U) || (sizeof(T) == 8U))) ||
+                                        std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Widest level supported by the CPU and the operating system
+inline Isa detectedIsa() noexcept
+{
+#if defined(CONTAINERS_SIMD_X86)
+    static const Isa detected = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return Isa::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return Isa::AVX2;
+        }
+        return Isa::SSE2;
+    }();
+    return detected;
+#else
+    return Isa::SCALAR;
+#endif
+}
+
+namespace detail
+{
+inline std::atomic<Isa> &activeIsa() noexcept
+{
+    static std::atomic<Isa> active{detectedIsa()};
+    return active;
+}
+
+namespace scalar
+{
+template <typename T> inline std::size_t find(const T *data, const std::size_t size, const T value) noexcept
+{
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+        if (data[i] == value)
+        {
+            return i;
+        }
+    }
+    return size;
+}
+
+template <typename T> inline std::size_t count(const T *data, const std::size_t size, const T value) noexcept
+{
+    std::size_t result = 0U;
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+        result += static_cast<std::size_t>(data[i] == value);
+    }
+    return result;
+}
+
+template <typename T> inline bool equal(const T *lhs, const T *rhs, const std::size_t size) noexcept
+{
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+        if (!(lhs[i] == rhs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T> inline void fill(T *data, const std::size_t size, const T value) noexcept
+{
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+        data[i] = value;
+    }
+}
+
+// Both require size > 0
+template <typename T> inline T min(const T *data, const std::size_t size) noexcept
+{
+    T result = data[0U];
+    for (std::size_t i = 1U; i < size; ++i)
+    {
+        result = (data[i] < result) ? data[i] : result;
+    }
+    return result;
+}
+
+template <typename T> inline T max(const T *data, const std::size_t size) noexcept
+{
+    T result = data[0U];
+    for (std::size_t i = 1U; i < size; ++i)
+    {
+        result = (result < data[i]) ? data[i] : result;
+    }
+    return result;
+}
+} // namespace scalar
+
+#if defined(CONTAINERS_SIMD_X86)
+// SSE2 is part of the x86-64 baseline, so this level needs no target override
+namespace sse2
+{
+template <typename T> struct Ops
+{
+    static constexpr bool IS_FLOAT = std::is_same_v<T, float>;
+    static constexpr bool IS_DOUBLE = std::is_same_v<T, double>;
+    static constexpr bool IS_64 = (sizeof(T) == 8U);
+
+    using Vector = std::conditional_t<IS_FLOAT, __m128, std::conditional_t<IS_DOUBLE, __m128d, __m128i>>;
+
+    static constexpr std::size_t LANES = 16U / sizeof(T);
+    static constexpr unsigned FULL_MASK = (1U << LANES) - 1U;
+
+    // SSE2 has no 64-bit integer compare-greater
+    static constexpr bool HAS_MIN_MAX = IS_FLOAT || IS_DOUBLE || !IS_64;
+
+    static inline Vector load(const T *p) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm_loadu_ps(p);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm_loadu_pd(p);
+        }
+        else
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        }
+    }
+
+    static inline void store(T *p, const Vector v) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            _mm_storeu_ps(p, v);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            _mm_storeu_pd(p, v);
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+        }
+    }
+
+    static inline Vector broadcast(const T value) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm_set1_ps(value);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm_set1_pd(value);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm_set1_epi64x(static_cast<long long>(value));
+        }
+        else
+        {
+            return _mm_set1_epi32(static_cast<int>(value));
+        }
+    }
+
+    // All bits set in the lanes that are equal
+    static inline __m128i equalLanes(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm_castps_si128(_mm_cmpeq_ps(a, b));
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm_castpd_si128(_mm_cmpeq_pd(a, b));
+        }
+        else if constexpr (IS_64)
+        {
+            // Both 32-bit halves have to match
+            const __m128i halves = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        else
+        {
+            return _mm_cmpeq_epi32(a, b);
+        }
+    }
+
+    // One bit per lane
+    static inline unsigned equalMask(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_64)
+        {
+            return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(equalLanes(a, b))));
+        }
+        else
+        {
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equalLanes(a, b))));
+        }
+    }
+
+    // Mask of lanes where a > b, 32-bit integers only
+    static inline __m128i greater(const __m128i a, const __m128i b) noexcept
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return _mm_cmpgt_epi32(a, b);
+        }
+        else
+        {
+            const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000U));
+            return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+        }
+    }
+
+    static inline Vector min(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm_min_ps(a, b);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm_min_pd(a, b);
+        }
+        else
+        {
+            const __m128i a_greater = greater(a, b);
+            return _mm_or_si128(_mm_and_si128(a_greater, b), _mm_andnot_si128(a_greater, a));
+        }
+    }
+
+    static inline Vector max(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm_max_ps(a, b);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm_max_pd(a, b);
+        }
+        else
+        {
+            const __m128i a_greater = greater(a, b);
+            return _mm_or_si128(_mm_and_si128(a_greater, a), _mm_andnot_si128(a_greater, b));
+        }
+    }
+};
+
+template <typename T> std::size_t find(const T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector needle = O::broadcast(value);
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        const unsigned mask = O::equalMask(O::load(data + i), needle);
+        if (mask != 0U)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+
+    const std::size_t tail = scalar::find(data + i, size - i, value);
+    return i + tail;
+}
+
+// popcnt is not part of the SSE2 baseline, so the hits are counted per lane: equal lanes are -1 and get subtracted.
+// The 32-bit lane counters are summed up before they can overflow.
+template <typename T> std::size_t count(const T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector needle = O::broadcast(value);
+    constexpr std::size_t CHUNK = O::LANES * 0xFFFFFFFFULL;
+
+    std::size_t result = 0U;
+    std::size_t i = 0U;
+    while ((i + O::LANES) <= size)
+    {
+        const std::size_t chunk_end = std::min(size, i + CHUNK);
+        __m128i counters = _mm_setzero_si128();
+        for (; (i + O::LANES) <= chunk_end; i += O::LANES)
+        {
+            const __m128i equal = O::equalLanes(O::load(data + i), needle);
+            counters = O::IS_64 ? _mm_sub_epi64(counters, equal) : _mm_sub_epi32(counters, equal);
+        }
+
+        if constexpr (O::IS_64)
+        {
+            std::uint64_t lanes[2];
+            std::memcpy(lanes, &counters, sizeof(lanes));
+            result += static_cast<std::size_t>(lanes[0] + lanes[1]);
+        }
+        else
+        {
+            std::uint32_t lanes[4];
+            std::memcpy(lanes, &counters, sizeof(lanes));
+            result += static_cast<std::size_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+    }
+
+    return result + scalar::count(data + i, size - i, value);
+}
+
+template <typename T> bool equal(const T *lhs, const T *rhs, const std::size_t size) noexcept
+{
+    using O = Ops<T>;
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        if (O::equalMask(O::load(lhs + i), O::load(rhs + i)) != O::FULL_MASK)
+        {
+            return false;
+        }
+    }
+
+    return scalar::equal(lhs + i, rhs + i, size - i);
+}
+
+// Sizes below one vector use the scalar loop, the remainder is covered by one more store that overlaps the last full
+// vector
+template <typename T> void fill(T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    if (size < O::LANES)
+    {
+        scalar::fill(data, size, value);
+        return;
+    }
+
+    const typename O::Vector broadcast = O::broadcast(value);
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        O::store(data + i, broadcast);
+    }
+    if (i < size)
+    {
+        O::store(data + size - O::LANES, broadcast);
+    }
+}
+
+// IsMin selects the reduction; 64-bit integers have no SSE2 compare and use the scalar loop
+template <typename T, bool IsMin> T minMax(const T *data, const std::size_t size) noexcept
+{
+    using O = Ops<T>;
+    if constexpr (!O::HAS_MIN_MAX)
+    {
+        return IsMin ? scalar::min(data, size) : scalar::max(data, size);
+    }
+    else
+    {
+        if (size < O::LANES)
+        {
+            return IsMin ? scalar::min(data, size) : scalar::max(data, size);
+        }
+
+        typename O::Vector accumulator = O::load(data);
+        std::size_t i = O::LANES;
+        for (; (i + O::LANES) <= size; i += O::LANES)
+        {
+            accumulator = IsMin ? O::min(accumulator, O::load(data + i)) : O::max(accumulator, O::load(data + i));
+        }
+
+        // The remaining elements overlap with the last full vector, which does not change a min or max
+        accumulator = IsMin ? O::min(accumulator, O::load(data + size - O::LANES))
+                            : O::max(accumulator, O::load(data + size - O::LANES));
+
+        alignas(16) T lanes[O::LANES];
+        std::memcpy(lanes, &accumulator, sizeof(lanes));
+        return IsMin ? scalar::min(lanes, O::LANES) : scalar::max(lanes, O::LANES);
+    }
+}
+} // namespace sse2
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2
+{
+template <typename T> struct Ops
+{
+    static constexpr bool IS_FLOAT = std::is_same_v<T, float>;
+    static constexpr bool IS_DOUBLE = std::is_same_v<T, double>;
+    static constexpr bool IS_64 = (sizeof(T) == 8U);
+
+    using Vector = std::conditional_t<IS_FLOAT, __m256, std::conditional_t<IS_DOUBLE, __m256d, __m256i>>;
+
+    static constexpr std::size_t LANES = 32U / sizeof(T);
+    static constexpr unsigned FULL_MASK = (1U << LANES) - 1U;
+    static constexpr bool HAS_MIN_MAX = true;
+
+    static inline Vector load(const T *p) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm256_loadu_ps(p);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm256_loadu_pd(p);
+        }
+        else
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        }
+    }
+
+    static inline void store(T *p, const Vector v) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            _mm256_storeu_ps(p, v);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            _mm256_storeu_pd(p, v);
+        }
+        else
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+        }
+    }
+
+    static inline Vector broadcast(const T value) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm256_set1_ps(value);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm256_set1_pd(value);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+        else
+        {
+            return _mm256_set1_epi32(static_cast<int>(value));
+        }
+    }
+
+    static inline unsigned equalMask(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+        }
+        else if constexpr (IS_64)
+        {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+        }
+        else
+        {
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+        }
+    }
+
+    // Mask of lanes where a > b, 64-bit integers only
+    static inline __m256i greater64(const __m256i a, const __m256i b) noexcept
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return _mm256_cmpgt_epi64(a, b);
+        }
+        else
+        {
+            const __m256i bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+        }
+    }
+
+    static inline Vector min(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm256_min_ps(a, b);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm256_min_pd(a, b);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm256_blendv_epi8(a, b, greater64(a, b));
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            return _mm256_min_epi32(a, b);
+        }
+        else
+        {
+            return _mm256_min_epu32(a, b);
+        }
+    }
+
+    static inline Vector max(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm256_max_ps(a, b);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm256_max_pd(a, b);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm256_blendv_epi8(b, a, greater64(a, b));
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            return _mm256_max_epi32(a, b);
+        }
+        else
+        {
+            return _mm256_max_epu32(a, b);
+        }
+    }
+};
+
+template <typename T> std::size_t find(const T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector needle = O::broadcast(value);
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        const unsigned mask = O::equalMask(O::load(data + i), needle);
+        if (mask != 0U)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+
+    const std::size_t tail = scalar::find(data + i, size - i, value);
+    return i + tail;
+}
+
+template <typename T> std::size_t count(const T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector needle = O::broadcast(value);
+
+    std::size_t result = 0U;
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        result += static_cast<std::size_t>(std::popcount(O::equalMask(O::load(data + i), needle)));
+    }
+
+    return result + scalar::count(data + i, size - i, value);
+}
+
+template <typename T> bool equal(const T *lhs, const T *rhs, const std::size_t size) noexcept
+{
+    using O = Ops<T>;
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        if (O::equalMask(O::load(lhs + i), O::load(rhs + i)) != O::FULL_MASK)
+        {
+            return false;
+        }
+    }
+
+    return scalar::equal(lhs + i, rhs + i, size - i);
+}
+
+template <typename T> void fill(T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    if (size < O::LANES)
+    {
+        scalar::fill(data, size, value);
+        return;
+    }
+
+    const typename O::Vector broadcast = O::broadcast(value);
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        O::store(data + i, broadcast);
+    }
+    if (i < size)
+    {
+        O::store(data + size - O::LANES, broadcast);
+    }
+}
+
+template <typename T, bool IsMin> T minMax(const T *data, const std::size_t size) noexcept
+{
+    using O = Ops<T>;
+    if (size < O::LANES)
+    {
+        return IsMin ? scalar::min(data, size) : scalar::max(data, size);
+    }
+
+    typename O::Vector accumulator = O::load(data);
+    std::size_t i = O::LANES;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        accumulator = IsMin ? O::min(accumulator, O::load(data + i)) : O::max(accumulator, O::load(data + i));
+    }
+
+    // The remaining elements overlap with the last full vector, which does not change a min or max
+    accumulator = IsMin ? O::min(accumulator, O::load(data + size - O::LANES))
+                        : O::max(accumulator, O::load(data + size - O::LANES));
+
+    alignas(32) T lanes[O::LANES];
+    std::memcpy(lanes, &accumulator, sizeof(lanes));
+    return IsMin ? scalar::min(lanes, O::LANES) : scalar::max(lanes, O::LANES);
+}
+} // namespace avx2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+namespace avx512
+{
+// AVX-512 compares produce lane masks directly and the tail is handled with masked loads
+template <typename T> struct Ops
+{
+    static constexpr bool IS_FLOAT = std::is_same_v<T, float>;
+    static constexpr bool IS_DOUBLE = std::is_same_v<T, double>;
+    static constexpr bool IS_64 = (sizeof(T) == 8U);
+
+    using Vector = std::conditional_t<IS_FLOAT, __m512, std::conditional_t<IS_DOUBLE, __m512d, __m512i>>;
+    using Mask = std::conditional_t<IS_64, __mmask8, __mmask16>;
+
+    static constexpr std::size_t LANES = 64U / sizeof(T);
+
+    static inline Mask tailMask(const std::size_t count) noexcept
+    {
+        return static_cast<Mask>((1U << count) - 1U);
+    }
+
+    static inline Vector load(const T *p) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm512_loadu_ps(p);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm512_loadu_pd(p);
+        }
+        else
+        {
+            return _mm512_loadu_si512(p);
+        }
+    }
+
+    // Lanes outside mask are zero and never fault
+    static inline Vector maskedLoad(const Mask mask, const T *p) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm512_maskz_loadu_ps(mask, p);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm512_maskz_loadu_pd(mask, p);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm512_maskz_loadu_epi64(mask, p);
+        }
+        else
+        {
+            return _mm512_maskz_loadu_epi32(mask, p);
+        }
+    }
+
+    static inline void store(T *p, const Vector v) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            _mm512_storeu_ps(p, v);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            _mm512_storeu_pd(p, v);
+        }
+        else
+        {
+            _mm512_storeu_si512(p, v);
+        }
+    }
+
+    // Lanes outside mask are not written
+    static inline void maskedStore(T *p, const Mask mask, const Vector v) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            _mm512_mask_storeu_ps(p, mask, v);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            _mm512_mask_storeu_pd(p, mask, v);
+        }
+        else if constexpr (IS_64)
+        {
+            _mm512_mask_storeu_epi64(p, mask, v);
+        }
+        else
+        {
+            _mm512_mask_storeu_epi32(p, mask, v);
+        }
+    }
+
+    static inline Vector broadcast(const T value) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm512_set1_ps(value);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm512_set1_pd(value);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm512_set1_epi64(static_cast<long long>(value));
+        }
+        else
+        {
+            return _mm512_set1_epi32(static_cast<int>(value));
+        }
+    }
+
+    static inline Mask equalMask(const Vector a, const Vector b) noexcept
+    {
+        if constexpr (IS_FLOAT)
+        {
+            return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+        }
+        else if constexpr (IS_64)
+        {
+            return _mm512_cmpeq_epi64_mask(a, b);
+        }
+        else
+        {
+            return _mm512_cmpeq_epi32_mask(a, b);
+        }
+    }
+
+    // The unmasked min/max intrinsics merge into _mm512_undefined_*(), which GCC reports as maybe-uninitialized. The
+    // masked forms with a full mask and a as the merge source compile to the same instruction.
+    static inline Vector min(const Vector a, const Vector b) noexcept
+    {
+        constexpr Mask full = static_cast<Mask>((1U << LANES) - 1U);
+        if constexpr (IS_FLOAT)
+        {
+            return _mm512_mask_min_ps(a, full, a, b);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm512_mask_min_pd(a, full, a, b);
+        }
+        else if constexpr (IS_64)
+        {
+            return std::is_signed_v<T> ? _mm512_mask_min_epi64(a, full, a, b) : _mm512_mask_min_epu64(a, full, a, b);
+        }
+        else
+        {
+            return std::is_signed_v<T> ? _mm512_mask_min_epi32(a, full, a, b) : _mm512_mask_min_epu32(a, full, a, b);
+        }
+    }
+
+    static inline Vector max(const Vector a, const Vector b) noexcept
+    {
+        constexpr Mask full = static_cast<Mask>((1U << LANES) - 1U);
+        if constexpr (IS_FLOAT)
+        {
+            return _mm512_mask_max_ps(a, full, a, b);
+        }
+        else if constexpr (IS_DOUBLE)
+        {
+            return _mm512_mask_max_pd(a, full, a, b);
+        }
+        else if constexpr (IS_64)
+        {
+            return std::is_signed_v<T> ? _mm512_mask_max_epi64(a, full, a, b) : _mm512_mask_max_epu64(a, full, a, b);
+        }
+        else
+        {
+            return std::is_signed_v<T> ? _mm512_mask_max_epi32(a, full, a, b) : _mm512_mask_max_epu32(a, full, a, b);
+        }
+    }
+};
+
+template <typename T> std::size_t find(const T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector needle = O::broadcast(value);
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        const unsigned mask = O::equalMask(O::load(data + i), needle);
+        if (mask != 0U)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+
+    if (i < size)
+    {
+        const typename O::Mask tail = O::tailMask(size - i);
+        const unsigned mask = O::equalMask(O::maskedLoad(tail, data + i), needle) & tail;
+        if (mask != 0U)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+
+    return size;
+}
+
+template <typename T> std::size_t count(const T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector needle = O::broadcast(value);
+
+    std::size_t result = 0U;
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        const unsigned mask = O::equalMask(O::load(data + i), needle);
+        result += static_cast<std::size_t>(std::popcount(mask));
+    }
+
+    if (i < size)
+    {
+        const typename O::Mask tail = O::tailMask(size - i);
+        const unsigned mask = O::equalMask(O::maskedLoad(tail, data + i), needle) & tail;
+        result += static_cast<std::size_t>(std::popcount(mask));
+    }
+
+    return result;
+}
+
+template <typename T> bool equal(const T *lhs, const T *rhs, const std::size_t size) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Mask full = O::tailMask(O::LANES);
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        if (O::equalMask(O::load(lhs + i), O::load(rhs + i)) != full)
+        {
+            return false;
+        }
+    }
+
+    return scalar::equal(lhs + i, rhs + i, size - i);
+}
+
+template <typename T> void fill(T *data, const std::size_t size, const T value) noexcept
+{
+    using O = Ops<T>;
+    const typename O::Vector broadcast = O::broadcast(value);
+
+    std::size_t i = 0U;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        O::store(data + i, broadcast);
+    }
+    if (i < size)
+    {
+        O::maskedStore(data + i, O::tailMask(size - i), broadcast);
+    }
+}
+
+template <typename T, bool IsMin> T minMax(const T *data, const std::size_t size) noexcept
+{
+    using O = Ops<T>;
+    if (size < O::LANES)
+    {
+        return IsMin ? scalar::min(data, size) : scalar::max(data, size);
+    }
+
+    typename O::Vector accumulator = O::load(data);
+    std::size_t i = O::LANES;
+    for (; (i + O::LANES) <= size; i += O::LANES)
+    {
+        accumulator = IsMin ? O::min(accumulator, O::load(data + i)) : O::max(accumulator, O::load(data + i));
+    }
+
+    // The remaining elements overlap with the last full vector, which does not change a min or max
+    accumulator = IsMin ? O::min(accumulator, O::load(data + size - O::LANES))
+                        : O::max(accumulator, O::load(data + size - O::LANES));
+
+    alignas(64) T lanes[O::LANES];
+    std::memcpy(lanes, &accumulator, sizeof(lanes));
+    return IsMin ? scalar::min(lanes, O::LANES) : scalar::max(lanes, O::LANES);
+}
+} // namespace avx512
+#pragma GCC pop_options
+#endif // CONTAINERS_SIMD_X86
+
+// Calls Kernel with the instruction set level that is active for T
+template <typename T, typename Kernel> inline decltype(auto) dispatch(Kernel &&kernel)
+{
+    if constexpr (IS_VECTORISABLE<T>)
+    {
+        return kernel(activeIsa().load(std::memory_order_relaxed));
+    }
+    else
+    {
+        return kernel(Isa::SCALAR);
+    }
+}
+
+// Upper bound for the fully unrolled fixed-capacity variants, larger arrays use the runtime dispatch
+inline constexpr std::size_t UNROLL_LIMIT = 64U;
+} // namespace detail
+
+// Level used by the algorithms, by default detectedIsa()
+inline Isa activeIsa() noexcept
+{
+    return detail::activeIsa().load(std::memory_order_relaxed);
+}
+
+// Restricts the algorithms to level, e.g. for benchmarking. Levels the CPU does not support are clamped to
+// detectedIsa(). Returns the level that is now active.
+inline Isa setActiveIsa(const Isa level) noexcept
+{
+    const Isa applied = std::min(level, detectedIsa());
+    detail::activeIsa().store(applied, std::memory_order_relaxed);
+    return applied;
+}
+
+// Index of the first element equal to value, or size if there is none
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline std::size_t find(const T *data, const std::size_t size, const T value) noexcept
+{
+    return detail::dispatch<T>([&](const Isa level) -> std::size_t {
+#if defined(CONTAINERS_SIMD_X86)
+        if constexpr (IS_VECTORISABLE<T>)
+        {
+            switch (level)
+            {
+            case Isa::AVX512:
+                return detail::avx512::find(data, size, value);
+            case Isa::AVX2:
+                return detail::avx2::find(data, size, value);
+            case Isa::SSE2:
+                return detail::sse2::find(data, size, value);
+            default:
+                break;
+            }
+        }
+#endif
+        static_cast<void>(level);
+        return detail::scalar::find(data, size, value);
+    });
+}
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline std::size_t count(const T *data, const std::size_t size, const T value) noexcept
+{
+    return detail::dispatch<T>([&](const Isa level) -> std::size_t {
+#if defined(CONTAINERS_SIMD_X86)
+        if constexpr (IS_VECTORISABLE<T>)
+        {
+            switch (level)
+            {
+            case Isa::AVX512:
+                return detail::avx512::count(data, size, value);
+            case Isa::AVX2:
+                return detail::avx2::count(data, size, value);
+            case Isa::SSE2:
+                return detail::sse2::count(data, size, value);
+            default:
+                break;
+            }
+        }
+#endif
+        static_cast<void>(level);
+        return detail::scalar::count(data, size, value);
+    });
+}
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline bool contains(const T *data, const std::size_t size, const T value) noexcept
+{
+    return (find(data, size, value) != size);
+}
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline bool equal(const T *lhs, const T *rhs, const std::size_t size) noexcept
+{
+    return detail::dispatch<T>([&](const Isa level) -> bool {
+#if defined(CONTAINERS_SIMD_X86)
+        if constexpr (IS_VECTORISABLE<T>)
+        {
+            switch (level)
+            {
+            case Isa::AVX512:
+                return detail::avx512::equal(lhs, rhs, size);
+            case Isa::AVX2:
+                return detail::avx2::equal(lhs, rhs, size);
+            case Isa::SSE2:
+                return detail::sse2::equal(lhs, rhs, size);
+            default:
+                break;
+            }
+        }
+#endif
+        static_cast<void>(level);
+        return detail::scalar::equal(lhs, rhs, size);
+    });
+}
+
+// Sets all size elements to value
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline void fill(T *data, const std::size_t size, const T value) noexcept
+{
+    detail::dispatch<T>([&](const Isa level) {
+#if defined(CONTAINERS_SIMD_X86)
+        if constexpr (IS_VECTORISABLE<T>)
+        {
+            switch (level)
+            {
+            case Isa::AVX512:
+                return detail::avx512::fill(data, size, value);
+            case Isa::AVX2:
+                return detail::avx2::fill(data, size, value);
+            case Isa::SSE2:
+                return detail::sse2::fill(data, size, value);
+            default:
+                break;
+            }
+        }
+#endif
+        static_cast<void>(level);
+        detail::scalar::fill(data, size, value);
+    });
+}
+
+// Smallest element, requires size > 0
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline T min(const T *data, const std::size_t size) noexcept
+{
+    return detail::dispatch<T>([&](const Isa level) -> T {
+#if defined(CONTAINERS_SIMD_X86)
+        if constexpr (IS_VECTORISABLE<T>)
+        {
+            switch (level)
+            {
+            case Isa::AVX512:
+                return detail::avx512::minMax<T, true>(data, size);
+            case Isa::AVX2:
+                return detail::avx2::minMax<T, true>(data, size);
+            case Isa::SSE2:
+                return detail::sse2::minMax<T, true>(data, size);
+            default:
+                break;
+            }
+        }
+#endif
+        static_cast<void>(level);
+        return detail::scalar::min(data, size);
+    });
+}
+
+// Largest element, requires size > 0
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline T max(const T *data, const std::size_t size) noexcept
+{
+    return detail::dispatch<T>([&](const Isa level) -> T {
+#if defined(CONTAINERS_SIMD_X86)
+        if constexpr (IS_VECTORISABLE<T>)
+        {
+            switch (level)
+            {
+            case Isa::AVX512:
+                return detail::avx512::minMax<T, false>(data, size);
+            case Isa::AVX2:
+                return detail::avx2::minMax<T, false>(data, size);
+            case Isa::SSE2:
+                return detail::sse2::minMax<T, false>(data, size);
+            default:
+                break;
+            }
+        }
+#endif
+        static_cast<void>(level);
+        return detail::scalar::max(data, size);
+    });
+}
+
+// Fixed-capacity variants: the whole array is processed with a compile-time trip count and no early exit, which the
+// compiler fully unrolls into branchless vector code for the build's baseline instruction set
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline std::size_t find(std::span<const T, N> data, const T value) noexcept
+{
+    const std::uint64_t mask = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return (... | (static_cast<std::uint64_t>(data[Is] == value) << Is));
+    }(std::make_index_sequence<N>{});
+
+    return (mask == 0U) ? N : static_cast<std::size_t>(std::countr_zero(mask));
+}
+
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline std::size_t count(std::span<const T, N> data, const T value) noexcept
+{
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return (... + static_cast<std::size_t>(data[Is] == value));
+    }(std::make_index_sequence<N>{});
+}
+
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline bool contains(std::span<const T, N> data, const T value) noexcept
+{
+    return (find(data, value) != N);
+}
+
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline bool equal(std::span<const T, N> lhs, std::span<const T, N> rhs) noexcept
+{
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) { return (... & (lhs[Is] == rhs[Is])); }(
+        std::make_index_sequence<N>{});
+}
+
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline void fill(std::span<T, N> data, const T value) noexcept
+{
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) { (..., (data[Is] = value)); }(std::make_index_sequence<N>{});
+}
+
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline T min(std::span<const T, N> data) noexcept
+{
+    T result = data[0U];
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        (..., (result = (data[Is] < result) ? data[Is] : result));
+    }(std::make_index_sequence<N>{});
+    return result;
+}
+
+template <typename T, std::size_t N>
+    requires(std::is_arithmetic_v<T> && (N > 0U) && (N <= detail::UNROLL_LIMIT))
+inline T max(std::span<const T, N> data) noexcept
+{
+    T result = data[0U];
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        (..., (result = (result < data[Is]) ? data[Is] : result));
+    }(std::make_index_sequence<N>{});
+    return result;
+}
+
+// GenericVector overloads. A vector that is filled to its compile-time capacity takes the unrolled fixed-capacity
+// path, everything else the runtime-dispatched one.
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy>
+    requires std::is_arithmetic_v<T>
+inline typename GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy>::const_iterator find(
+    const GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy> &vector, const T value) noexcept
+{
+    if constexpr (MaxSize <= detail::UNROLL_LIMIT)
+    {
+        if (vector.size() == MaxSize)
+        {
+            const std::size_t index = find(std::span<const T, MaxSize>{&vector[0U], MaxSize}, value);
+            return vector.cbegin() + static_cast<std::ptrdiff_t>(index);
+        }
+    }
+
+    return vector.cbegin() + static_cast<std::ptrdiff_t>(find(&vector[0U], vector.size(), value));
+}
+
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy>
+    requires std::is_arithmetic_v<T>
+inline std::size_t count(const GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy> &vector, const T value) noexcept
+{
+    if constexpr (MaxSize <= detail::UNROLL_LIMIT)
+    {
+        if (vector.size() == MaxSize)
+        {
+            return count(std::span<const T, MaxSize>{&vector[0U], MaxSize}, value);
+        }
+    }
+
+    return count(&vector[0U], vector.size(), value);
+}
+
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy>
+    requires std::is_arithmetic_v<T>
+inline bool contains(const GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy> &vector, const T value) noexcept
+{
+    return (find(vector, value) != vector.cend());
+}
+
+// Same size and element-wise equal; the allocation and stats policies may differ
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class LhsPolicy, typename LhsStats,
+          template <typename, std::size_t> class RhsPolicy, typename RhsStats>
+    requires std::is_arithmetic_v<T>
+inline bool equal(const GenericVector<T, MaxSize, LhsPolicy, LhsStats> &lhs,
+                  const GenericVector<T, MaxSize, RhsPolicy, RhsStats> &rhs) noexcept
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    if constexpr (MaxSize <= detail::UNROLL_LIMIT)
+    {
+        if (lhs.size() == MaxSize)
+        {
+            return equal(std::span<const T, MaxSize>{&lhs[0U], MaxSize},
+                         std::span<const T, MaxSize>{&rhs[0U], MaxSize});
+        }
+    }
+
+    return equal(&lhs[0U], &rhs[0U], lhs.size());
+}
+
+// Sets the elements the vector holds to value, the size is unchanged
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy>
+    requires std::is_arithmetic_v<T>
+inline void fill(GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy> &vector, const T value) noexcept
+{
+    if (vector.empty())
+    {
+        return;
+    }
+
+    if constexpr (MaxSize <= detail::UNROLL_LIMIT)
+    {
+        if (vector.size() == MaxSize)
+        {
+            fill(std::span<T, MaxSize>{&vector[0U], MaxSize}, value);
+            return;
+        }
+    }
+
+    fill(&vector[0U], vector.size(), value);
+}
+
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy>
+    requires std::is_arithmetic_v<T>
+inline T min(const GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy> &vector)
+{
+    if (vector.empty())
+    {
+        throw std::runtime_error("Empty container.");
+    }
+
+    if constexpr (MaxSize <= detail::UNROLL_LIMIT)
+    {
+        if (vector.size() == MaxSize)
+        {
+            return min(std::span<const T, MaxSize>{&vector[0U], MaxSize});
+        }
+    }
+
+    return min(&vector[0U], vector.size());
+}
+
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename StatsPolicy>
+    requires std::is_arithmetic_v<T>
+inline T max(const GenericVector<T, MaxSize, AllocationPolicy, StatsPolicy> &vector)
+{
+    if (vector.empty())
+    {
+        throw std::runtime_error("Empty container.");
+    }
+
+    if constexpr (MaxSize <= detail::UNROLL_LIMIT)
+    {
+        if (vector.size() == MaxSize)
+        {
+            return max(std::span<const T, MaxSize>{&vector[0U], MaxSize});
+        }
+    }
+
+    return max(&vector[0U], vector.size());
+}
+} // namespace simd
+} // namespace containers
+
+#if defined(CONTAINERS_SIMD_X86)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // CONTAINERS_SIMD_ALGORITHMS_HPP
@@ -0,0 +1,462 @@
+#ifndef CONTAINERS_SLIDING_WINDOW_HPP
+#define CONTAINERS_SLIDING_WINDOW_HPP
+
+#include "circular_buffer.hpp"
+#include "reserved_pool_allocator.hpp"
+#include "static_deque.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Incremental aggregates over the last Size values pushed into a CircularBuffer. Pushing into a full window evicts
+// the oldest value, as with OverflowBehaviour::OVERFLOW_OLDEST, and every aggregate is updated in O(1) amortised time
+// instead of rescanning the window on every tick.
+
+// Neumaier's variant of Kahan summation, which also stays accurate when the addend is larger than the running sum.
+// Subtracting evicted values keeps the error bounded instead of letting it drift with the number of ticks.
+template <typename T> class CompensatedSum
+{
+    static_assert(std::is_floating_point_v<T>, "CompensatedSum requires a floating-point type.");
+
+  public:
+    inline void add(const T value) noexcept
+    {
+        // The order of the running sum and the addend is random around zero, so select instead of branching
+        const bool larger = std::abs(sum_) >= std::abs(value);
+        const T big = larger ? sum_ : value;
+        const T small = larger ? value : sum_;
+        const T total = sum_ + value;
+        compensation_ += (big - total) + small;
+        sum_ = total;
+    }
+
+    inline void subtract(const T value) noexcept
+    {
+        add(-value);
+    }
+
+    inline T value() const noexcept
+    {
+        return (sum_ + compensation_);
+    }
+
+    inline void clear() noexcept
+    {
+        sum_ = T{0};
+        compensation_ = T{0};
+    }
+
+  private:
+    T sum_{0};
+    T compensation_{0};
+};
+
+namespace detail
+{
+// Monotonic deque: the front is the extremum of the window, values that can never become the extremum again are
+// dropped from the back when a better value arrives. Every value is pushed and popped at most once.
+template <typename T, std::size_t Size, template <typename, std::size_t> class StoragePolicy, typename Better>
+class MonotonicDeque
+{
+    struct Entry
+    {
+        T value;
+        std::uint64_t sequence;
+    };
+
+  public:
+    inline void push(const T value, const std::uint64_t sequence)
+    {
+        while (!entries_.empty() && !Better{}(entries_.back().value, value))
+        {
+            entries_.pop_back();
+        }
+        entries_.push_back(Entry{value, sequence});
+    }
+
+    // Called with the sequence number of the value leaving the window
+    inline void evict(const std::uint64_t sequence) noexcept
+    {
+        if (!entries_.empty() && (entries_.front().sequence == sequence))
+        {
+            entries_.pop_front();
+        }
+    }
+
+    inline T front() const
+    {
+        return entries_.front().value;
+    }
+
+    inline void clear() noexcept
+    {
+        entries_.clear();
+    }
+
+  private:
+    StaticDeque<Entry, Size, StoragePolicy> entries_;
+};
+} // namespace detail
+
+// Rolling sum, mean, variance, min and max of the last Size values. Sums are compensated and taken relative to a value
+// of the window, which avoids the cancellation of the textbook sum-of-squares variance for prices far from zero. The
+// reference value is moved to the oldest value once every Size evictions and the sums are recomputed, so it keeps up
+// with a drifting series at O(1) amortised cost.
+template <typename T, std::size_t Size, template <typename, std::size_t> class StoragePolicy = HeapStorage>
+class RollingStatistics
+{
+    static_assert(std::is_floating_point_v<T>, "RollingStatistics requires a floating-point type.");
+
+  public:
+    void push(const T value)
+    {
+        if (values_.full())
+        {
+            evict();
+        }
+        if (values_.empty())
+        {
+            shift_ = value;
+        }
+
+        values_.push(value);
+        addShifted(value);
+        min_.push(value, pushed_);
+        max_.push(value, pushed_);
+        ++pushed_;
+
+        if (evictions_ == Size)
+        {
+            rebase();
+        }
+    }
+
+    inline T sum() const noexcept
+    {
+        return (sum_.value() + (static_cast<T>(size()) * shift_));
+    }
+
+    inline T mean() const
+    {
+        requireValues();
+        return (shift_ + (sum_.value() / static_cast<T>(size())));
+    }
+
+    // Sample variance, 0 for a single value
+    inline T variance() const
+    {
+        requireValues();
+        if (size() < 2U)
+        {
+            return T{0};
+        }
+
+        const T count = static_cast<T>(size());
+        const T sum = sum_.value();
+        return std::max(T{0}, (sum_of_squares_.value() - ((sum * sum) / count)) / (count - T{1}));
+    }
+
+    inline T stddev() const
+    {
+        return std::sqrt(variance());
+    }
+
+    inline T min() const
+    {
+        requireValues();
+        return min_.front();
+    }
+
+    inline T max() const
+    {
+        requireValues();
+        return max_.front();
+    }
+
+    // The values in the window, oldest first
+    inline const CircularBuffer<T, Size, StoragePolicy> &values() const noexcept
+    {
+        return values_;
+    }
+
+    inline void clear() noexcept
+    {
+        values_.clear();
+        sum_.clear();
+        sum_of_squares_.clear();
+        min_.clear();
+        max_.clear();
+        evictions_ = 0U;
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return values_.size();
+    }
+
+    inline bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    inline bool full() const noexcept
+    {
+        return values_.full();
+    }
+
+  private:
+    inline void evict()
+    {
+        const std::uint64_t oldest = pushed_ - values_.size();
+        const T delta = values_.pop() - shift_;
+        sum_.subtract(delta);
+        sum_of_squares_.subtract(delta * delta);
+        min_.evict(oldest);
+        max_.evict(oldest);
+        ++evictions_;
+    }
+
+    // Recomputes the sums relative to the oldest value, whose distance to the other values is bounded by the spread
+    // of the window rather than by how far the series has drifted since the reference was taken
+    void rebase()
+    {
+        shift_ = values_.front();
+        sum_.clear();
+        sum_of_squares_.clear();
+
+        const RingSegments<const T> window = std::as_const(values_).segments();
+        for (const T value : window.first)
+        {
+            addShifted(value);
+        }
+        for (const T value : window.second)
+        {
+            addShifted(value);
+        }
+        evictions_ = 0U;
+    }
+
+    inline void addShifted(const T value) noexcept
+    {
+        const T delta = value - shift_;
+        sum_.add(delta);
+        sum_of_squares_.add(delta * delta);
+    }
+
+    inline void requireValues() const
+    {
+        if (values_.empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+    }
+
+    CircularBuffer<T, Size, StoragePolicy> values_;
+    CompensatedSum<T> sum_;
+    CompensatedSum<T> sum_of_squares_;
+    detail::MonotonicDeque<T, Size, StoragePolicy, std::less<>> min_;
+    detail::MonotonicDeque<T, Size, StoragePolicy, std::greater<>> max_;
+    std::uint64_t pushed_{0U};
+    T shift_{0};
+
+    // Evictions since the sums were last recomputed
+    std::size_t evictions_{0U};
+};
+
+template <typename T> struct Tick
+{
+    T price;
+    T volume;
+};
+
+// Rolling volume-weighted average price of the last Size ticks
+template <typename T, std::size_t Size, template <typename, std::size_t> class StoragePolicy = HeapStorage>
+class RollingVwap
+{
+    static_assert(std::is_floating_point_v<T>, "RollingVwap requires a floating-point type.");
+
+  public:
+    void push(const T price, const T volume)
+    {
+        if (ticks_.full())
+        {
+            const Tick<T> oldest = ticks_.pop();
+            notional_.subtract(oldest.price * oldest.volume);
+            volume_.subtract(oldest.volume);
+        }
+
+        ticks_.push(Tick<T>{price, volume});
+        notional_.add(price * volume);
+        volume_.add(volume);
+    }
+
+    // Throws if the window holds no volume
+    inline T vwap() const
+    {
+        const T volume = volume_.value();
+        if (!(volume > T{0}))
+        {
+            throw std::runtime_error("No volume in window.");
+        }
+
+        return (notional_.value() / volume);
+    }
+
+    inline T volume() const noexcept
+    {
+        return volume_.value();
+    }
+
+    inline const CircularBuffer<Tick<T>, Size, StoragePolicy> &ticks() const noexcept
+    {
+        return ticks_;
+    }
+
+    inline void clear() noexcept
+    {
+        ticks_.clear();
+        notional_.clear();
+        volume_.clear();
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return ticks_.size();
+    }
+
+    inline bool empty() const noexcept
+    {
+        return ticks_.empty();
+    }
+
+  private:
+    CircularBuffer<Tick<T>, Size, StoragePolicy> ticks_;
+    CompensatedSum<T> notional_;
+    CompensatedSum<T> volume_;
+};
+
+// Aggregates the window with any associative Monoid, which need not be commutative or invertible:
+//
+//     struct Monoid
+//     {
+//         using value_type = ...;
+//         static value_type identity();
+//         static value_type combine(const value_type &older, const value_type &newer);
+//         static value_type lift(const T &value); // optional when T is value_type
+//     };
+//
+// Two-stack aggregation: the older part of the window keeps suffix aggregates in a deque, the newer part a single
+// running aggregate, and a query combines the two. When the older part runs empty, the window is flipped by
+// recomputing the suffix aggregates of all values, so every value is combined a constant number of times.
+template <typename T, std::size_t Size, typename Monoid,
+          template <typename, std::size_t> class StoragePolicy = HeapStorage>
+class WindowAggregator
+{
+  public:
+    using value_type = typename Monoid::value_type;
+
+    void push(const T &value)
+    {
+        if (values_.full())
+        {
+            evict();
+        }
+
+        values_.push(value);
+        back_ = Monoid::combine(back_, lift(value));
+    }
+
+    // Aggregate of the window from the oldest to the newest value, identity() if empty
+    inline value_type query() const
+    {
+        return front_.empty() ? back_ : Monoid::combine(front_.front(), back_);
+    }
+
+    inline const CircularBuffer<T, Size, StoragePolicy> &values() const noexcept
+    {
+        return values_;
+    }
+
+    inline void clear() noexcept
+    {
+        values_.clear();
+        front_.clear();
+        back_ = Monoid::identity();
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return values_.size();
+    }
+
+    inline bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    inline bool full() const noexcept
+    {
+        return values_.full();
+    }
+
+  private:
+    static inline value_type lift(const T &value)
+    {
+        if constexpr (requires { Monoid::lift(value); })
+        {
+            return Monoid::lift(value);
+        }
+        else
+        {
+            return value;
+        }
+    }
+
+    inline void evict()
+    {
+        if (front_.empty())
+        {
+            flip();
+        }
+
+        values_.release_read(1U);
+        front_.pop_front();
+    }
+
+    // Moves every value to the older part, newest first so each suffix builds on the previous one
+    void flip()
+    {
+        const RingSegments<const T> window = std::as_const(values_).segments();
+        value_type suffix = Monoid::identity();
+        for (auto it = window.second.rbegin(); it != window.second.rend(); ++it)
+        {
+            suffix = Monoid::combine(lift(*it), suffix);
+            front_.push_front(suffix);
+        }
+        for (auto it = window.first.rbegin(); it != window.first.rend(); ++it)
+        {
+            suffix = Monoid::combine(lift(*it), suffix);
+            front_.push_front(suffix);
+        }
+        back_ = Monoid::identity();
+    }
+
+    CircularBuffer<T, Size, StoragePolicy> values_;
+
+    // Aggregate from each value of the older part to the end of that part, the oldest at the front
+    StaticDeque<value_type, Size, StoragePolicy> front_;
+
+    // Aggregate of the newer part
+    value_type back_{Monoid::identity()};
+};
+} // namespace containers
+
+#endif // CONTAINERS_SLIDING_WINDOW_HPP
@@ -0,0 +1,322 @@
+#ifndef CONTAINERS_SLOT_MAP_HPP
+#define CONTAINERS_SLOT_MAP_HPP
+
+#include "generic_vector.hpp"
+#include "heap_allocation_policy.hpp"
+#include "stack_allocation_policy.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Fixed-capacity map from generated handles to values. The values are kept densely packed for iteration, an erase
+// moves the last value into the hole, and a table of slots maps each handle to the current position of its value.
+// Freed slots are reused through a free list embedded in the slot table.
+//
+// A handle is a HandleType (std::uint32_t or std::uint64_t) holding the slot index in its low bits and the slot's
+// generation in the remaining high bits. The generation advances on every insert and erase, so a handle to an erased
+// value no longer matches its slot. Resolving a handle takes one bounds check and one comparison of the handle with
+// the value stored in its slot. Generations wrap around, so a stale handle matches again after 2^(generation bits - 1)
+// reuses of its slot; use 64-bit handles where slots churn that often.
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy,
+          typename HandleType = std::uint64_t>
+class SlotMap
+{
+    static_assert((MaxSize > 0U), "SlotMap must have non-zero size.");
+    static_assert(std::is_same_v<HandleType, std::uint32_t> || std::is_same_v<HandleType, std::uint64_t>,
+                  "HandleType must be either std::uint32_t or std::uint64_t");
+    static_assert((MaxSize < std::numeric_limits<std::uint32_t>::max()), "SlotMap's MaxSize must fit in 32 bits.");
+
+    // Wide enough that the all-ones index is out of range, which makes the default handle invalid
+    static constexpr std::size_t INDEX_BITS = static_cast<std::size_t>(std::bit_width(MaxSize));
+    static constexpr std::size_t GENERATION_BITS = std::numeric_limits<HandleType>::digits - INDEX_BITS;
+
+    static_assert((GENERATION_BITS >= 8U), "SlotMap's MaxSize leaves fewer than 8 generation bits in HandleType.");
+
+    static constexpr HandleType INDEX_MASK = (HandleType{1U} << INDEX_BITS) - 1U;
+    static constexpr HandleType ONE_GENERATION = HandleType{1U} << INDEX_BITS;
+
+    using Index = std::uint32_t;
+
+    static constexpr Index NO_SLOT = std::numeric_limits<Index>::max();
+
+    // A live slot holds the handle of its value (odd generation) and the value's position, a free slot a handle with an
+    // even generation and the next free slot
+    struct Slot
+    {
+        HandleType handle;
+        Index link;
+    };
+
+  public:
+    using value_type = T;
+    using iterator = typename GenericVector<T, MaxSize, AllocationPolicy>::iterator;
+    using const_iterator = typename GenericVector<T, MaxSize, AllocationPolicy>::const_iterator;
+
+    static constexpr auto MAX_SIZE = MaxSize;
+
+    class Handle
+    {
+      public:
+        using value_type = HandleType;
+
+        // Never refers to a value
+        constexpr Handle() noexcept = default;
+
+        // Restores a handle from value(), e.g. after storing it as an external ID
+        explicit constexpr Handle(const HandleType value) noexcept : value_{value}
+        {
+        }
+
+        constexpr HandleType value() const noexcept
+        {
+            return value_;
+        }
+
+        constexpr bool operator==(const Handle &) const noexcept = default;
+
+      private:
+        HandleType value_{std::numeric_limits<HandleType>::max()};
+    };
+
+    // Default constructor
+    SlotMap() = default;
+
+    SlotMap(const SlotMap &) = default;
+    SlotMap &operator=(const SlotMap &) = default;
+
+    // Move constructor, the moved-from map is left empty
+    SlotMap(SlotMap &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : values_{std::move(other.values_)}, positions_{std::move(other.positions_)}, slots_{std::move(other.slots_)},
+          free_head_{std::exchange(other.free_head_, NO_SLOT)}
+    {
+    }
+
+    // Move assignment operator, the moved-from map is left empty
+    SlotMap &operator=(SlotMap &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            values_ = std::move(other.values_);
+            positions_ = std::move(other.positions_);
+            slots_ = std::move(other.slots_);
+            free_head_ = std::exchange(other.free_head_, NO_SLOT);
+        }
+
+        return *this;
+    }
+
+    template <typename U> inline Handle insert(U &&value)
+    {
+        return emplace(std::forward<U>(value));
+    }
+
+    template <typename... Args> Handle emplace(Args &&...args)
+    {
+        if (full())
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        // Construct first, so a throwing constructor leaves the map unchanged
+        values_.emplace_back(std::forward<Args>(args)...);
+        const Index position = static_cast<Index>(values_.size() - 1U);
+
+        Index index;
+        if (free_head_ != NO_SLOT)
+        {
+            index = free_head_;
+            free_head_ = slots_[index].link;
+            slots_[index].handle += ONE_GENERATION;
+        }
+        else
+        {
+            // Every slot is live, so there is room for another one
+            index = static_cast<Index>(slots_.size());
+            slots_.push_back(Slot{ONE_GENERATION | HandleType{index}, NO_SLOT});
+        }
+
+        slots_[index].link = position;
+        positions_.push_back(index);
+        return Handle{slots_[index].handle};
+    }
+
+    // Returns the number of erased elements (0 or 1)
+    std::size_t erase(const Handle handle)
+    {
+        const std::size_t index = static_cast<std::size_t>(handle.value() & INDEX_MASK);
+        if (!live(handle, index))
+        {
+            return 0U;
+        }
+
+        // Move the last value into the hole to keep the values dense
+        const Index position = slots_[index].link;
+        const Index last = static_cast<Index>(values_.size() - 1U);
+        if (position != last)
+        {
+            values_[position] = std::move(values_[last]);
+            positions_[position] = positions_[last];
+            slots_[positions_[position]].link = position;
+        }
+        values_.pop_back();
+        positions_.pop_back();
+
+        release(static_cast<Index>(index));
+        return 1U;
+    }
+
+    // Returns nullptr for stale or default handles
+    inline T *find(const Handle handle) noexcept
+    {
+        const std::size_t index = static_cast<std::size_t>(handle.value() & INDEX_MASK);
+        return live(handle, index) ? &values_[slots_[index].link] : nullptr;
+    }
+
+    inline const T *find(const Handle handle) const noexcept
+    {
+        const std::size_t index = static_cast<std::size_t>(handle.value() & INDEX_MASK);
+        return live(handle, index) ? &values_[slots_[index].link] : nullptr;
+    }
+
+    inline bool contains(const Handle handle) const noexcept
+    {
+        return live(handle, static_cast<std::size_t>(handle.value() & INDEX_MASK));
+    }
+
+    inline T &at(const Handle handle)
+    {
+        T *const value = find(handle);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("Invalid handle.");
+        }
+
+        return *value;
+    }
+
+    inline const T &at(const Handle handle) const
+    {
+        const T *const value = find(handle);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("Invalid handle.");
+        }
+
+        return *value;
+    }
+
+    // Unchecked, the handle must be live
+    inline T &operator[](const Handle handle) noexcept
+    {
+        return values_[slots_[static_cast<std::size_t>(handle.value() & INDEX_MASK)].link];
+    }
+
+    inline const T &operator[](const Handle handle) const noexcept
+    {
+        return values_[slots_[static_cast<std::size_t>(handle.value() & INDEX_MASK)].link];
+    }
+
+    // Handle of the value at a position of the dense iteration order
+    inline Handle handleAt(const std::size_t position) const noexcept
+    {
+        return Handle{slots_[positions_[position]].handle};
+    }
+
+    // Invalidates all handles; generations are kept so that old handles stay stale
+    void clear() noexcept
+    {
+        for (std::size_t position = values_.size(); position > 0U; --position)
+        {
+            release(positions_[position - 1U]);
+        }
+        values_.clear();
+        positions_.clear();
+    }
+
+    // Iteration visits the values in dense order, which changes when values are erased
+    inline iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    inline iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return values_.cbegin();
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return values_.cend();
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return values_.cbegin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return values_.cend();
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return values_.size();
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MaxSize;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    inline bool full() const noexcept
+    {
+        return (values_.size() == MaxSize);
+    }
+
+  private:
+    inline bool live(const Handle handle, const std::size_t index) const noexcept
+    {
+        return (index < slots_.size()) && (slots_[index].handle == handle.value());
+    }
+
+    inline void release(const Index index) noexcept
+    {
+        slots_[index].handle += ONE_GENERATION;
+        slots_[index].link = free_head_;
+        free_head_ = index;
+    }
+
+    GenericVector<T, MaxSize, AllocationPolicy> values_;
+
+    // Slot index of every value, parallel to values_
+    GenericVector<Index, MaxSize, AllocationPolicy> positions_;
+
+    GenericVector<Slot, MaxSize, AllocationPolicy> slots_;
+    Index free_head_{NO_SLOT};
+};
+
+template <typename T, std::size_t MaxSize, typename HandleType = std::uint64_t>
+using StackSlotMap = SlotMap<T, MaxSize, StackAllocationPolicy, HandleType>;
+template <typename T, std::size_t MaxSize, typename HandleType = std::uint64_t>
+using HeapSlotMap = SlotMap<T, MaxSize, HeapAllocationPolicy, HandleType>;
+} // namespace containers
+
+#endif // CONTAINERS_SLOT_MAP_HPP
@@ -0,0 +1,459 @@
+#ifndef CONTAINERS_SMALL_VECTOR_HPP
+#define CONTAINERS_SMALL_VECTOR_HPP
+
+#include "relocation.hpp"
+#include "stack_allocation_policy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Vector that keeps up to InlineN elements in inline storage and only allocates once it grows beyond that. Heap
+// capacity grows geometrically; shrink_to_fit() moves the elements back inline when they fit. Iterators and references
+// are invalidated whenever the elements move between inline storage and the heap.
+template <typename T, std::size_t InlineN> class SmallVector final : private StackAllocationPolicy<T, InlineN>
+{
+    static_assert(InlineN > 0U, "SmallVector must have room for at least 1 inline element.");
+
+    using StackAllocationPolicy<T, InlineN>::getData;
+
+    // Moving elements to a new buffer has to leave the old elements intact if construction can throw
+    static constexpr bool NOTHROW_RELOCATE = is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+  public:
+    static constexpr auto INLINE_CAPACITY = InlineN;
+
+    using value_type = T;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Default constructor
+    SmallVector() noexcept : data_{inlineData()}, size_{0U}, capacity_{InlineN}
+    {
+    }
+
+    // Destructor
+    ~SmallVector()
+    {
+        clear();
+        releaseHeap();
+    }
+
+    // Copy constructor
+    SmallVector(const SmallVector &other) : SmallVector{}
+    {
+        reserve(other.size_);
+        uninitializedCopy(other.data_, other.size_, data_);
+        size_ = other.size_;
+    }
+
+    // Copy assignment operator
+    SmallVector &operator=(const SmallVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size_);
+            uninitializedCopy(other.data_, other.size_, data_);
+            size_ = other.size_;
+        }
+
+        return *this;
+    }
+
+    // Move constructor, takes over the heap buffer or relocates the inline elements
+    SmallVector(SmallVector &&other) noexcept(NOTHROW_RELOCATE) : SmallVector{}
+    {
+        takeFrom(other);
+    }
+
+    // Move assignment operator
+    SmallVector &operator=(SmallVector &&other) noexcept(NOTHROW_RELOCATE)
+    {
+        if (this != &other)
+        {
+            clear();
+            releaseHeap();
+            takeFrom(other);
+        }
+
+        return *this;
+    }
+
+    void swap(SmallVector &other) noexcept(NOTHROW_RELOCATE)
+    {
+        SmallVector temp{std::move(other)};
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    inline iterator begin() noexcept
+    {
+        return data_;
+    }
+
+    inline iterator end() noexcept
+    {
+        return data_ + size_;
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return data_;
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return data_;
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    inline reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator{end()};
+    }
+
+    inline reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{begin()};
+    }
+
+    inline const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{cend()};
+    }
+
+    inline const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{cbegin()};
+    }
+
+    template <typename U> inline void push_back(U &&value)
+    {
+        emplace_back(std::forward<U>(value));
+    }
+
+    template <typename... Args> inline void emplace_back(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            growAndEmplace(std::forward<Args>(args)...);
+            return;
+        }
+
+        new (data_ + size_) T{std::forward<Args>(args)...};
+        ++size_;
+    }
+
+    inline void pop_back()
+    {
+        if (size_ == 0U)
+        {
+            throw std::runtime_error("Attempting to remove an element from the empty container.");
+        }
+
+        --size_;
+        destroyElements(data_ + size_, 1U);
+    }
+
+    void resize(const std::size_t new_size, const T &value = T{})
+    {
+        if (new_size < size_)
+        {
+            destroyElements(data_ + new_size, size_ - new_size);
+        }
+        else if (new_size > size_)
+        {
+            if (new_size > capacity_)
+            {
+                // value may refer to an element of this vector, keep a copy before the elements move
+                const T copy{value};
+                reallocate(std::max(new_size, 2U * capacity_));
+                std::uninitialized_fill_n(data_ + size_, new_size - size_, copy);
+            }
+            else
+            {
+                std::uninitialized_fill_n(data_ + size_, new_size - size_, value);
+            }
+        }
+
+        size_ = new_size;
+    }
+
+    // Makes room for at least new_capacity elements
+    void reserve(const std::size_t new_capacity)
+    {
+        if (new_capacity > capacity_)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Moves the elements back into inline storage if they fit, otherwise trims the heap buffer to size()
+    void shrink_to_fit()
+    {
+        if (isInline() || (size_ == capacity_))
+        {
+            return;
+        }
+
+        if (size_ <= InlineN)
+        {
+            T *const heap = data_;
+            moveElements(heap, size_, inlineData());
+            ::operator delete(heap, capacity_ * sizeof(T), std::align_val_t{alignof(T)});
+            data_ = inlineData();
+            capacity_ = InlineN;
+        }
+        else
+        {
+            reallocate(size_);
+        }
+    }
+
+    inline void clear() noexcept
+    {
+        destroyElements(data_, size_);
+        size_ = 0U;
+    }
+
+    inline T &at(const std::size_t index)
+    {
+        if (index >= size_)
+        {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        return data_[index];
+    }
+
+    inline const T &at(const std::size_t index) const
+    {
+        if (index >= size_)
+        {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        return data_[index];
+    }
+
+    inline T &operator[](const std::size_t index) noexcept
+    {
+        return data_[index];
+    }
+
+    inline const T &operator[](const std::size_t index) const noexcept
+    {
+        return data_[index];
+    }
+
+    inline T *data() noexcept
+    {
+        return data_;
+    }
+
+    inline const T *data() const noexcept
+    {
+        return data_;
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    inline std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (size_ == 0U);
+    }
+
+    // True while the elements live in the inline storage, i.e. nothing has been allocated
+    inline bool isInline() const noexcept
+    {
+        return (data_ == inlineData());
+    }
+
+    inline T &front()
+    {
+        if (size_ == 0U)
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return data_[0U];
+    }
+
+    inline const T &front() const
+    {
+        if (size_ == 0U)
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return data_[0U];
+    }
+
+    inline T &back()
+    {
+        if (size_ == 0U)
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return data_[size_ - 1U];
+    }
+
+    inline const T &back() const
+    {
+        if (size_ == 0U)
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return data_[size_ - 1U];
+    }
+
+  private:
+    inline T *inlineData() noexcept
+    {
+        return &getData(0U);
+    }
+
+    inline const T *inlineData() const noexcept
+    {
+        return &getData(0U);
+    }
+
+    static inline T *allocateHeap(const std::size_t capacity)
+    {
+        return static_cast<T *>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    inline void releaseHeap() noexcept
+    {
+        if (!isInline())
+        {
+            ::operator delete(data_, capacity_ * sizeof(T), std::align_val_t{alignof(T)});
+            data_ = inlineData();
+            capacity_ = InlineN;
+        }
+    }
+
+    // Moves count elements to uninitialised destination and ends the lifetime of the sources. Types that may throw on
+    // move are copied instead, so the sources are untouched if an exception escapes (like std::move_if_noexcept).
+    static inline void moveElements(T *source, const std::size_t count, T *destination)
+    {
+        if constexpr (NOTHROW_RELOCATE || !std::is_copy_constructible_v<T>)
+        {
+            uninitializedRelocate(source, count, destination);
+        }
+        else
+        {
+            uninitializedCopy(static_cast<const T *>(source), count, destination);
+            destroyElements(source, count);
+        }
+    }
+
+    void reallocate(const std::size_t new_capacity)
+    {
+        T *const buffer = allocateHeap(new_capacity);
+        try
+        {
+            moveElements(data_, size_, buffer);
+        }
+        catch (...)
+        {
+            ::operator delete(buffer, new_capacity * sizeof(T), std::align_val_t{alignof(T)});
+            throw;
+        }
+
+        releaseHeap();
+        data_ = buffer;
+        capacity_ = new_capacity;
+    }
+
+    // The new element is constructed before the old ones move, so args may refer to an element of this vector
+    template <typename... Args> void growAndEmplace(Args &&...args)
+    {
+        const std::size_t new_capacity = 2U * capacity_;
+        T *const buffer = allocateHeap(new_capacity);
+        try
+        {
+            new (buffer + size_) T{std::forward<Args>(args)...};
+            try
+            {
+                moveElements(data_, size_, buffer);
+            }
+            catch (...)
+            {
+                destroyElements(buffer + size_, 1U);
+                throw;
+            }
+        }
+        catch (...)
+        {
+            ::operator delete(buffer, new_capacity * sizeof(T), std::align_val_t{alignof(T)});
+            throw;
+        }
+
+        releaseHeap();
+        data_ = buffer;
+        capacity_ = new_capacity;
+        ++size_;
+    }
+
+    void takeFrom(SmallVector &other)
+    {
+        if (other.isInline())
+        {
+            moveElements(other.data_, other.size_, inlineData());
+        }
+        else
+        {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.capacity_ = InlineN;
+        }
+
+        size_ = other.size_;
+        other.size_ = 0U;
+    }
+
+    T *data_;
+    std::size_t size_;
+    std::size_t capacity_;
+};
+
+template <typename T, std::size_t InlineN>
+void swap(SmallVector<T, InlineN> &lhs, SmallVector<T, InlineN> &rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+    lhs.swap(rhs);
+}
+} // namespace containers
+
+#endif // CONTAINERS_SMALL_VECTOR_HPP
@@ -0,0 +1,431 @@
+#ifndef CONTAINERS_SOA_VECTOR_HPP
+#define CONTAINERS_SOA_VECTOR_HPP
+
+#include "cache_line.hpp"
+#include "heap_allocation_policy.hpp"
+#include "relocation.hpp"
+#include "stack_allocation_policy.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Vector of records stored as a structure of arrays: every field lives in its own contiguous, cache-line aligned
+// column, so a pass over one field only touches that field's memory and column<I>() can be vectorised. Elements are
+// accessed through proxy references, tuples of references to the fields.
+template <std::size_t MaxSize, template <typename, std::size_t> class AllocationPolicy, typename... Fields>
+class SoAVector
+{
+    static_assert(sizeof...(Fields) > 0U, "SoAVector needs at least one field.");
+    static_assert((... && (alignof(Fields) <= CACHE_LINE_SIZE)),
+                  "SoAVector fields must not exceed cache line alignment.");
+
+    struct alignas(CACHE_LINE_SIZE) CacheLine
+    {
+        std::byte bytes[CACHE_LINE_SIZE];
+    };
+
+    // One column is an allocation policy over whole cache lines, which aligns the column start to a cache line and
+    // rounds its size up to whole lines
+    template <typename T>
+    class Column : private AllocationPolicy<CacheLine, (MaxSize * sizeof(T) + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE>
+    {
+        using Policy = AllocationPolicy<CacheLine, (MaxSize * sizeof(T) + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE>;
+
+      public:
+        Column() = default;
+
+        inline T *data() noexcept
+        {
+            return static_cast<T *>(static_cast<void *>(&Policy::getData(0U)));
+        }
+
+        inline const T *data() const noexcept
+        {
+            return static_cast<const T *>(static_cast<const void *>(&Policy::getData(0U)));
+        }
+    };
+
+    using Indices = std::index_sequence_for<Fields...>;
+
+  public:
+    static constexpr auto MAX_SIZE = MaxSize;
+
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<const Fields &...>;
+
+    template <std::size_t I> using field_type = std::tuple_element_t<I, value_type>;
+
+    // Default constructor
+    SoAVector() : size_{0U}
+    {
+    }
+
+    // Destructor
+    ~SoAVector()
+    {
+        clear();
+    }
+
+    // Copy constructor
+    SoAVector(const SoAVector &other) : size_{0U}
+    {
+        copyFrom(other, Indices{});
+    }
+
+    // Copy assignment operator
+    SoAVector &operator=(const SoAVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copyFrom(other, Indices{});
+        }
+
+        return *this;
+    }
+
+    // Move constructor, relocates the elements so the source is left empty
+    SoAVector(SoAVector &&other) noexcept((... && (is_trivially_relocatable_v<Fields> ||
+                                                   std::is_nothrow_move_constructible_v<Fields>)))
+        : size_{0U}
+    {
+        relocateFrom(other, Indices{});
+    }
+
+    // Move assignment operator
+    SoAVector &operator=(SoAVector &&other) noexcept((... && (is_trivially_relocatable_v<Fields> ||
+                                                              std::is_nothrow_move_constructible_v<Fields>)))
+    {
+        if (this != &other)
+        {
+            clear();
+            relocateFrom(other, Indices{});
+        }
+
+        return *this;
+    }
+
+    template <bool IsConst> class basic_iterator final
+    {
+        using Owner = std::conditional_t<IsConst, const SoAVector, SoAVector>;
+
+      public:
+        // Dereferencing yields a proxy, so the iterator only models the C++20 random access iterator concept
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::tuple<Fields...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, std::tuple<const Fields &...>, std::tuple<Fields &...>>;
+
+        basic_iterator() noexcept : owner_{nullptr}, index_{0U}
+        {
+        }
+
+        basic_iterator(Owner *owner, const std::size_t index) noexcept : owner_{owner}, index_{index}
+        {
+        }
+
+        // Allows conversion from iterator to const_iterator
+        template <bool OtherConst>
+            requires(IsConst && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst> &other) noexcept : owner_{other.owner_}, index_{other.index_}
+        {
+        }
+
+        inline reference operator*() const noexcept
+        {
+            return (*owner_)[index_];
+        }
+
+        inline reference operator[](const difference_type n) const noexcept
+        {
+            return (*owner_)[static_cast<std::size_t>(static_cast<difference_type>(index_) + n)];
+        }
+
+        inline basic_iterator &operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        inline basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++index_;
+            return temp;
+        }
+
+        inline basic_iterator &operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        inline basic_iterator operator--(int) noexcept
+        {
+            basic_iterator temp = *this;
+            --index_;
+            return temp;
+        }
+
+        inline basic_iterator &operator+=(const difference_type n) noexcept
+        {
+            index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n);
+            return *this;
+        }
+
+        inline basic_iterator &operator-=(const difference_type n) noexcept
+        {
+            index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) - n);
+            return *this;
+        }
+
+        inline basic_iterator operator+(const difference_type n) const noexcept
+        {
+            basic_iterator temp = *this;
+            return (temp += n);
+        }
+
+        inline friend basic_iterator operator+(const difference_type n, const basic_iterator &it) noexcept
+        {
+            return (it + n);
+        }
+
+        inline basic_iterator operator-(const difference_type n) const noexcept
+        {
+            basic_iterator temp = *this;
+            return (temp -= n);
+        }
+
+        inline difference_type operator-(const basic_iterator &other) const noexcept
+        {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        inline friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ == b.index_);
+        }
+
+        inline friend auto operator<=>(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ <=> b.index_);
+        }
+
+      private:
+        friend class basic_iterator<!IsConst>;
+
+        Owner *owner_;
+        std::size_t index_;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    inline iterator begin() noexcept
+    {
+        return iterator{this, 0U};
+    }
+
+    inline iterator end() noexcept
+    {
+        return iterator{this, size_};
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator{this, 0U};
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator{this, size_};
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    inline void push_back(const value_type &value)
+    {
+        std::apply([this](const Fields &...fields) { emplace_back(fields...); }, value);
+    }
+
+    inline void push_back(value_type &&value)
+    {
+        std::apply([this](Fields &...fields) { emplace_back(std::move(fields)...); }, value);
+    }
+
+    // Takes exactly one argument per field
+    template <typename... Args>
+        requires(sizeof...(Args) == sizeof...(Fields))
+    inline void emplace_back(Args &&...args)
+    {
+        if (size_ >= MAX_SIZE)
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        constructAt(size_, Indices{}, std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    inline void pop_back()
+    {
+        if (size_ == 0U)
+        {
+            throw std::runtime_error("Attempting to remove an element from the empty container.");
+        }
+
+        --size_;
+        destroyRange(size_, 1U, Indices{});
+    }
+
+    inline void clear() noexcept
+    {
+        destroyRange(0U, size_, Indices{});
+        size_ = 0U;
+    }
+
+    // Contiguous, cache-line aligned array of field I
+    template <std::size_t I> inline std::span<field_type<I>> column() noexcept
+    {
+        return std::span<field_type<I>>{std::get<I>(columns_).data(), size_};
+    }
+
+    template <std::size_t I> inline std::span<const field_type<I>> column() const noexcept
+    {
+        return std::span<const field_type<I>>{std::get<I>(columns_).data(), size_};
+    }
+
+    inline reference operator[](const std::size_t index) noexcept
+    {
+        return referenceAt(index, Indices{});
+    }
+
+    inline const_reference operator[](const std::size_t index) const noexcept
+    {
+        return referenceAt(index, Indices{});
+    }
+
+    inline reference at(const std::size_t index)
+    {
+        if (index >= size_)
+        {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        return referenceAt(index, Indices{});
+    }
+
+    inline const_reference at(const std::size_t index) const
+    {
+        if (index >= size_)
+        {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        return referenceAt(index, Indices{});
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MAX_SIZE;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (size_ == 0U);
+    }
+
+  private:
+    template <std::size_t... Is> inline reference referenceAt(const std::size_t index, std::index_sequence<Is...>)
+    {
+        return reference{std::get<Is>(columns_).data()[index]...};
+    }
+
+    template <std::size_t... Is>
+    inline const_reference referenceAt(const std::size_t index, std::index_sequence<Is...>) const
+    {
+        return const_reference{std::get<Is>(columns_).data()[index]...};
+    }
+
+    // Constructs the fields in order; if one throws, the already constructed fields of this element are destroyed
+    template <std::size_t... Is, typename... Args>
+    void constructAt(const std::size_t index, std::index_sequence<Is...>, Args &&...args)
+    {
+        std::size_t constructed = 0U;
+        try
+        {
+            (..., (new (std::get<Is>(columns_).data() + index) Fields{std::forward<Args>(args)}, ++constructed));
+        }
+        catch (...)
+        {
+            (..., ((Is < constructed) ? destroyElements(std::get<Is>(columns_).data() + index, 1U) : void()));
+            throw;
+        }
+    }
+
+    template <std::size_t... Is>
+    inline void destroyRange(const std::size_t first, const std::size_t count, std::index_sequence<Is...>) noexcept
+    {
+        (..., destroyElements(std::get<Is>(columns_).data() + first, count));
+    }
+
+    template <std::size_t... Is> void copyFrom(const SoAVector &other, std::index_sequence<Is...>)
+    {
+        std::size_t copied = 0U;
+        try
+        {
+            (..., (uninitializedCopy(std::get<Is>(other.columns_).data(), other.size_, std::get<Is>(columns_).data()),
+                   ++copied));
+        }
+        catch (...)
+        {
+            (..., ((Is < copied) ? destroyElements(std::get<Is>(columns_).data(), other.size_) : void()));
+            throw;
+        }
+
+        size_ = other.size_;
+    }
+
+    template <std::size_t... Is> void relocateFrom(SoAVector &other, std::index_sequence<Is...>)
+    {
+        (..., uninitializedRelocate(std::get<Is>(other.columns_).data(), other.size_, std::get<Is>(columns_).data()));
+        size_ = other.size_;
+        other.size_ = 0U;
+    }
+
+    std::tuple<Column<Fields>...> columns_;
+    std::size_t size_;
+};
+
+template <std::size_t MaxSize, typename... Fields>
+using StackSoAVector = SoAVector<MaxSize, StackAllocationPolicy, Fields...>;
+
+template <std::size_t MaxSize, typename... Fields>
+using HeapSoAVector = SoAVector<MaxSize, HeapAllocationPolicy, Fields...>;
+} // namespace containers
+
+#endif // CONTAINERS_SOA_VECTOR_HPP
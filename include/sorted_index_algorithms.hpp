@@ -0,0 +1,207 @@
+#ifndef CONTAINERS_SORTED_INDEX_ALGORITHMS_HPP
+#define CONTAINERS_SORTED_INDEX_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace containers
+{
+// Sorting algorithms expressed on indices rather than iterators. less(i, j) compares the elements at positions i and
+// j and swap(i, j) exchanges them, so the same algorithm can keep several parallel arrays (e.g. keys and values) in
+// sync. None of them allocate.
+namespace sorted_index
+{
+// Branchless lower bound: the loop body compiles to a conditional move instead of a hard-to-predict branch
+template <typename T, typename Compare, typename KeyLike>
+inline std::size_t lowerBound(const T *data, const std::size_t size, const KeyLike &key, const Compare &compare)
+{
+    if (size == 0U)
+    {
+        return 0U;
+    }
+
+    const T *base = data;
+    std::size_t length = size;
+    while (length > 1U)
+    {
+        const std::size_t half = length / 2U;
+        base = compare(base[half], key) ? (base + half) : base;
+        length -= half;
+    }
+
+    return static_cast<std::size_t>(base - data) + static_cast<std::size_t>(compare(*base, key));
+}
+
+template <typename Less, typename Swap>
+inline void siftDown(std::size_t root, const std::size_t first, const std::size_t length, Less &less, Swap &swap)
+{
+    for (;;)
+    {
+        const std::size_t left = (2U * root) + 1U;
+        if (left >= length)
+        {
+            return;
+        }
+
+        std::size_t largest = left;
+        const std::size_t right = left + 1U;
+        if ((right < length) && less(first + left, first + right))
+        {
+            largest = right;
+        }
+
+        if (!less(first + root, first + largest))
+        {
+            return;
+        }
+
+        swap(first + root, first + largest);
+        root = largest;
+    }
+}
+
+// In-place heap sort of [first, last), O(n log n) without extra memory. Not stable.
+template <typename Less, typename Swap>
+void heapSort(const std::size_t first, const std::size_t last, Less less, Swap swap)
+{
+    const std::size_t length = last - first;
+    if (length < 2U)
+    {
+        return;
+    }
+
+    for (std::size_t i = length / 2U; i > 0U; --i)
+    {
+        siftDown(i - 1U, first, length, less, swap);
+    }
+
+    for (std::size_t end = length - 1U; end > 0U; --end)
+    {
+        swap(first, first + end);
+        siftDown(0U, first, end, less, swap);
+    }
+}
+
+template <typename Swap> inline void reverse(std::size_t first, std::size_t last, Swap &swap)
+{
+    while ((first < last) && (first < --last))
+    {
+        swap(first, last);
+        ++first;
+    }
+}
+
+// Rotates [first, last) so that middle becomes first, returns the new position of the old first element
+template <typename Swap>
+inline std::size_t rotate(const std::size_t first, const std::size_t middle, const std::size_t last, Swap &swap)
+{
+    reverse(first, middle, swap);
+    reverse(middle, last, swap);
+    reverse(first, last, swap);
+    return first + (last - middle);
+}
+
+// Merges the sorted ranges [first, middle) and [middle, last) in place by recursive rotations
+template <typename Less, typename Swap>
+void mergeInPlace(const std::size_t first, const std::size_t middle, const std::size_t last, Less less, Swap swap)
+{
+    const std::size_t length_1 = middle - first;
+    const std::size_t length_2 = last - middle;
+    if ((length_1 == 0U) || (length_2 == 0U))
+    {
+        return;
+    }
+
+    if ((length_1 + length_2) == 2U)
+    {
+        if (less(middle, first))
+        {
+            swap(first, middle);
+        }
+        return;
+    }
+
+    std::size_t first_cut;
+    std::size_t second_cut;
+
+    if (length_1 > length_2)
+    {
+        // Lower bound of the element at first_cut in the second range
+        first_cut = first + (length_1 / 2U);
+        second_cut = middle;
+        for (std::size_t count = last - middle; count > 0U;)
+        {
+            const std::size_t step = count / 2U;
+            if (less(second_cut + step, first_cut))
+            {
+                second_cut += step + 1U;
+                count -= step + 1U;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+    }
+    else
+    {
+        // Upper bound of the element at second_cut in the first range
+        second_cut = middle + (length_2 / 2U);
+        first_cut = first;
+        for (std::size_t count = middle - first; count > 0U;)
+        {
+            const std::size_t step = count / 2U;
+            if (!less(second_cut, first_cut + step))
+            {
+                first_cut += step + 1U;
+                count -= step + 1U;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+    }
+
+    const std::size_t new_middle = rotate(first_cut, middle, second_cut, swap);
+    mergeInPlace(first, first_cut, new_middle, less, swap);
+    mergeInPlace(new_middle, second_cut, last, less, swap);
+}
+
+// Inserts value at index of a vector-like container, shifting the following elements back by one
+template <typename Vector, typename U> void insertAt(Vector &vector, const std::size_t index, U &&value)
+{
+    if (index == vector.size())
+    {
+        vector.push_back(std::forward<U>(value));
+        return;
+    }
+
+    const auto position = vector.begin() + static_cast<std::ptrdiff_t>(index);
+    vector.push_back(std::move(vector.back()));
+    std::move_backward(position, vector.end() - 2, vector.end() - 1);
+    vector[index] = std::forward<U>(value);
+}
+
+// Erases the element at index of a vector-like container, shifting the following elements forward by one
+template <typename Vector> void eraseAt(Vector &vector, const std::size_t index)
+{
+    const auto position = vector.begin() + static_cast<std::ptrdiff_t>(index);
+    std::move(position + 1, vector.end(), position);
+    vector.pop_back();
+}
+
+// Removes elements from the back until the container holds size elements
+template <typename Vector> inline void truncate(Vector &vector, const std::size_t size)
+{
+    while (vector.size() > size)
+    {
+        vector.pop_back();
+    }
+}
+} // namespace sorted_index
+} // namespace containers
+
+#endif // CONTAINERS_SORTED_INDEX_ALGORITHMS_HPP
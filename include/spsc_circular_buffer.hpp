@@ -0,0 +1,148 @@
+#ifndef CONTAINERS_SPSC_CIRCULAR_BUFFER_HPP
+#define CONTAINERS_SPSC_CIRCULAR_BUFFER_HPP
+
+#include "cache_line.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Lock-free circular buffer for exactly one producer thread and one consumer thread.
+// Head and tail are free-running counters that are masked with LAST_INDEX on access, so the buffer can hold SIZE
+// elements without a shared element count. Each side keeps a cached copy of the opposite index and only reloads it
+// when the cached value says the buffer is full (producer) or empty (consumer).
+template <typename T, std::size_t Size> class SpscCircularBuffer
+{
+    static_assert(((Size & (Size - 1U)) == 0U), "SpscCircularBuffer's Size must be a power of 2.");
+    static_assert((Size > 0U), "SpscCircularBuffer must have non-zero size.");
+
+    static constexpr std::size_t SIZE = Size;
+    static constexpr std::size_t LAST_INDEX = SIZE - 1U;
+
+  public:
+    using value_type = T;
+
+    // Default constructor
+    SpscCircularBuffer() noexcept = default;
+
+    // Destructor
+    ~SpscCircularBuffer()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+            for (std::size_t i = consumer_.head.load(std::memory_order_relaxed); i != tail; ++i)
+            {
+                slot(i)->~T();
+            }
+        }
+    }
+
+    // The indices are shared with other threads, the buffer must not be copied or moved
+    SpscCircularBuffer(const SpscCircularBuffer &) = delete;
+    SpscCircularBuffer &operator=(const SpscCircularBuffer &) = delete;
+    SpscCircularBuffer(SpscCircularBuffer &&) = delete;
+    SpscCircularBuffer &operator=(SpscCircularBuffer &&) = delete;
+
+    // Must only be called from the producer thread
+    template <typename U> bool try_push(U &&value) noexcept
+    {
+        return try_emplace(std::forward<U>(value));
+    }
+
+    // Must only be called from the producer thread
+    template <typename... Args> bool try_emplace(Args &&...args) noexcept
+    {
+        const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+
+        if ((tail - producer_.cached_head) == SIZE)
+        {
+            producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+            if ((tail - producer_.cached_head) == SIZE)
+            {
+                // Buffer is full, cannot emplace
+                return false;
+            }
+        }
+
+        new (slot(tail)) T{std::forward<Args>(args)...};
+        producer_.tail.store(tail + 1U, std::memory_order_release);
+
+        // Successfully emplaced
+        return true;
+    }
+
+    // Must only be called from the consumer thread
+    bool try_pop(T &out_value) noexcept
+    {
+        const std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+
+        if (head == consumer_.cached_tail)
+        {
+            consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+            if (head == consumer_.cached_tail)
+            {
+                // Buffer is empty, cannot pop
+                return false;
+            }
+        }
+
+        T *const element = slot(head);
+        out_value = std::move(*element);
+        element->~T();
+        consumer_.head.store(head + 1U, std::memory_order_release);
+
+        // Successfully popped
+        return true;
+    }
+
+    // Exact only when called from the producer or consumer thread while the other side is idle
+    inline std::size_t size() const noexcept
+    {
+        const std::size_t head = consumer_.head.load(std::memory_order_acquire);
+        const std::size_t tail = producer_.tail.load(std::memory_order_acquire);
+        return (tail - head);
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (size() == 0U);
+    }
+
+    inline bool full() const noexcept
+    {
+        return (size() == SIZE);
+    }
+
+  private:
+    // Written by the producer, read by the consumer
+    struct alignas(CACHE_LINE_SIZE) ProducerIndex
+    {
+        std::atomic<std::size_t> tail{0U};
+        std::size_t cached_head{0U};
+    };
+
+    // Written by the consumer, read by the producer
+    struct alignas(CACHE_LINE_SIZE) ConsumerIndex
+    {
+        std::atomic<std::size_t> head{0U};
+        std::size_t cached_tail{0U};
+    };
+
+    inline T *slot(const std::size_t index) noexcept
+    {
+        return static_cast<T *>(static_cast<void *>(&buffer_[(index & LAST_INDEX) * sizeof(T)]));
+    }
+
+    ProducerIndex producer_;
+    ConsumerIndex consumer_;
+    alignas(CACHE_LINE_SIZE) alignas(alignof(T)) std::byte buffer_[sizeof(T) * SIZE];
+};
+} // namespace containers
+
+#endif // CONTAINERS_SPSC_CIRCULAR_BUFFER_HPP
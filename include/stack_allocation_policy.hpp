@@ -29,7 +29,7 @@ template <typename T, std::size_t MaxSize> class StackAllocationPolicy
 
     inline const T &getData(const std::size_t index) const noexcept
     {
-        return *static_cast<T *>(static_cast<void *>(&data_[index * sizeof(T)]));
+        return *static_cast<const T *>(static_cast<const void *>(&data_[index * sizeof(T)]));
     }
 };
 } // namespace containers
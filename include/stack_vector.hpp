@@ -1,11 +1,14 @@
 #ifndef CONTAINERS_STACK_VECTOR_HPP
 #define CONTAINERS_STACK_VECTOR_HPP
 
+#include "relocation.hpp"
+
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <memory>
 #include <new>
 #include <stdexcept>
 #include <type_traits>
@@ -30,12 +33,10 @@ template <typename T, std::size_t MaxSize> class StackVector final
     }
 
     // Copy constructor
-    StackVector(const StackVector &other) : size_{other.size_}
+    StackVector(const StackVector &other) : size_{0U}
     {
-        for (std::size_t i = 0; i < size_; ++i)
-        {
-            new (&data_[i * sizeof(T)]) T{other[i]};
-        }
+        uninitializedCopy(other.elements(), other.size_, elements());
+        size_ = other.size_;
     }
 
     // Copy assignment operator
@@ -47,23 +48,18 @@ template <typename T, std::size_t MaxSize> class StackVector final
             clear();
 
             // Copy construct new elements
-            for (std::size_t i = 0; i < other.size_; ++i)
-            {
-                new (&data_[i * sizeof(T)]) T{other[i]};
-            }
+            uninitializedCopy(other.elements(), other.size_, elements());
             size_ = other.size_;
         }
 
         return *this;
     }
 
-    // Move constructor
-    StackVector(StackVector &&other) noexcept : size_{other.size_}
+    // Move constructor, relocates the elements so the source is left empty
+    StackVector(StackVector &&other) noexcept : size_{0U}
     {
-        for (std::size_t i = 0; i < size_; ++i)
-        {
-            new (&data_[i * sizeof(T)]) T{std::move(other[i])};
-        }
+        uninitializedRelocate(other.elements(), other.size_, elements());
+        size_ = other.size_;
         other.size_ = 0U;
     }
 
@@ -75,11 +71,8 @@ template <typename T, std::size_t MaxSize> class StackVector final
             // Destruct existing elements
             clear();
 
-            // Move construct new elements
-            for (std::size_t i = 0; i < other.size_; ++i)
-            {
-                new (&data_[i * sizeof(T)]) T{std::move(other[i])};
-            }
+            // Relocate elements
+            uninitializedRelocate(other.elements(), other.size_, elements());
             size_ = other.size_;
             other.size_ = 0U;
         }
@@ -89,14 +82,11 @@ template <typename T, std::size_t MaxSize> class StackVector final
 
     void swap(StackVector &other) noexcept
     {
+        // Swap contents
+        swapElements(elements(), size_, other.elements(), other.size_);
+
         // Swap sizes
         std::swap(size_, other.size_);
-
-        // Swap contents
-        for (std::size_t i = 0U; i < std::max(size_, other.size_); ++i)
-        {
-            std::swap(data_[i], other.data_[i]);
-        }
     }
 
     class iterator final
@@ -404,28 +394,15 @@ template <typename T, std::size_t MaxSize> class StackVector final
             throw std::runtime_error("Exceeds maximum size.");
         }
 
-        // Construct new elements if the new size is greater than the current size
         if (new_size > size_)
         {
-            for (std::size_t i = size_; i < new_size; ++i)
-            {
-                new (&data_[i * sizeof(T)]) T{value};
-            }
+            // Construct new elements if the new size is greater than the current size
+            std::uninitialized_fill_n(elements() + size_, new_size - size_, value);
         }
-
         else
         {
-            if constexpr (!std::is_trivially_destructible_v<T>)
-            {
-                // Destruct excess elements if the new size is smaller than the current size
-                if (new_size < size_)
-                {
-                    for (std::size_t i = new_size; i < size_; ++i)
-                    {
-                        static_cast<T *>(static_cast<void *>(&data_[i * sizeof(T)]))->~T();
-                    }
-                }
-            }
+            // Destruct excess elements if the new size is smaller than the current size
+            destroyElements(elements() + new_size, size_ - new_size);
         }
 
         size_ = new_size;
@@ -434,13 +411,7 @@ template <typename T, std::size_t MaxSize> class StackVector final
     inline void clear() noexcept
     {
         // Explicitly call the destructor for each constructed element
-        if constexpr (!std::is_trivially_destructible_v<T>)
-        {
-            for (std::size_t i = 0U; i < size_; ++i)
-            {
-                static_cast<T *>(static_cast<void *>(&data_[i * sizeof(T)]))->~T();
-            }
-        }
+        destroyElements(elements(), size_);
         size_ = 0U;
     }
 
@@ -530,6 +501,16 @@ template <typename T, std::size_t MaxSize> class StackVector final
     }
 
   private:
+    inline T *elements() noexcept
+    {
+        return static_cast<T *>(static_cast<void *>(data_));
+    }
+
+    inline const T *elements() const noexcept
+    {
+        return static_cast<const T *>(static_cast<const void *>(data_));
+    }
+
     std::size_t size_;
     alignas(alignof(T)) std::byte data_[sizeof(T) * MAX_SIZE];
 };
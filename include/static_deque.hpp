@@ -0,0 +1,354 @@
+#ifndef CONTAINERS_STATIC_DEQUE_HPP
+#define CONTAINERS_STATIC_DEQUE_HPP
+
+#include "reserved_pool_allocator.hpp"
+#include "ring_iterator.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Fixed-capacity double-ended queue on a power-of-two ring. Pushes and pops at both ends are O(1) and never move other
+// elements; operator[] masks the physical index instead of walking blocks like std::deque. As in CircularBuffer,
+// StoragePolicy provides uninitialised storage (StackStorage or HeapStorage) and elements are constructed when pushed
+// and destroyed when popped.
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class StoragePolicy = HeapStorage>
+class StaticDeque
+{
+    static_assert(std::has_single_bit(MaxSize), "StaticDeque's MaxSize must be a power of 2.");
+
+    static constexpr std::size_t MASK = MaxSize - 1U;
+
+  public:
+    using value_type = T;
+    using iterator = RingIterator<T, MaxSize>;
+    using const_iterator = RingIterator<const T, MaxSize>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr auto MAX_SIZE = MaxSize;
+
+    // Default constructor
+    StaticDeque() : storage_{}, head_{0U}, tail_{0U}
+    {
+    }
+
+    // Destructor
+    ~StaticDeque()
+    {
+        clear();
+    }
+
+    // Copy constructor, the elements are stored from the start of the new ring
+    StaticDeque(const StaticDeque &other) : storage_{}, head_{0U}, tail_{0U}
+    {
+        copyFrom(other);
+    }
+
+    // Copy assignment operator
+    StaticDeque &operator=(const StaticDeque &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copyFrom(other);
+        }
+
+        return *this;
+    }
+
+    // Move constructor, the storage itself cannot be moved so the elements are moved one by one
+    StaticDeque(StaticDeque &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : storage_{}, head_{0U}, tail_{0U}
+    {
+        moveFrom(other);
+    }
+
+    // Move assignment operator
+    StaticDeque &operator=(StaticDeque &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            moveFrom(other);
+        }
+
+        return *this;
+    }
+
+    inline iterator begin() noexcept
+    {
+        return iterator{storage_.buffer(), head_, 0U};
+    }
+
+    inline iterator end() noexcept
+    {
+        return iterator{storage_.buffer(), head_, size()};
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator{storage_.buffer(), head_, 0U};
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator{storage_.buffer(), head_, size()};
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    inline reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator{end()};
+    }
+
+    inline reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{begin()};
+    }
+
+    inline const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator{end()};
+    }
+
+    inline const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator{begin()};
+    }
+
+    inline const_reverse_iterator crbegin() const noexcept
+    {
+        return rbegin();
+    }
+
+    inline const_reverse_iterator crend() const noexcept
+    {
+        return rend();
+    }
+
+    template <typename U> inline void push_back(U &&value)
+    {
+        emplace_back(std::forward<U>(value));
+    }
+
+    template <typename U> inline void push_front(U &&value)
+    {
+        emplace_front(std::forward<U>(value));
+    }
+
+    template <typename... Args> inline void emplace_back(Args &&...args)
+    {
+        if (full())
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        new (slot(tail_)) T{std::forward<Args>(args)...};
+        ++tail_;
+    }
+
+    template <typename... Args> inline void emplace_front(Args &&...args)
+    {
+        if (full())
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        // head_ only moves once the element is constructed
+        new (slot(head_ - 1U)) T{std::forward<Args>(args)...};
+        --head_;
+    }
+
+    inline void pop_back()
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Attempting to remove an element from the empty container.");
+        }
+
+        --tail_;
+        std::destroy_at(slot(tail_));
+    }
+
+    inline void pop_front()
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Attempting to remove an element from the empty container.");
+        }
+
+        std::destroy_at(slot(head_));
+        ++head_;
+    }
+
+    inline void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (std::size_t i = head_; i != tail_; ++i)
+            {
+                std::destroy_at(slot(i));
+            }
+        }
+        head_ = 0U;
+        tail_ = 0U;
+    }
+
+    inline T &at(const std::size_t index)
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        return *slot(head_ + index);
+    }
+
+    inline const T &at(const std::size_t index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        return *slot(head_ + index);
+    }
+
+    inline T &operator[](const std::size_t index) noexcept
+    {
+        return *slot(head_ + index);
+    }
+
+    inline const T &operator[](const std::size_t index) const noexcept
+    {
+        return *slot(head_ + index);
+    }
+
+    inline T &front()
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return *slot(head_);
+    }
+
+    inline const T &front() const
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return *slot(head_);
+    }
+
+    inline T &back()
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return *slot(tail_ - 1U);
+    }
+
+    inline const T &back() const
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return *slot(tail_ - 1U);
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return (tail_ - head_);
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MaxSize;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (head_ == tail_);
+    }
+
+    inline bool full() const noexcept
+    {
+        return (size() == MaxSize);
+    }
+
+  private:
+    // Physical slot of an unmasked index
+    inline T *slot(const std::size_t index) noexcept
+    {
+        return storage_.buffer() + (index & MASK);
+    }
+
+    inline const T *slot(const std::size_t index) const noexcept
+    {
+        return storage_.buffer() + (index & MASK);
+    }
+
+    // Appends the elements of other to an empty deque, destroying the copies made so far if one throws
+    inline void copyFrom(const StaticDeque &other)
+    {
+        try
+        {
+            for (std::size_t i = 0U; i < other.size(); ++i)
+            {
+                new (slot(i)) T{other[i]};
+                ++tail_;
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    inline void moveFrom(StaticDeque &other)
+    {
+        for (std::size_t i = 0U; i < other.size(); ++i)
+        {
+            new (slot(i)) T{std::move(other[i])};
+            ++tail_;
+        }
+        other.clear();
+    }
+
+    StoragePolicy<T, MaxSize> storage_;
+
+    // Free-running counters, masked only on access, so each end updates a single counter and size() is the difference
+    std::size_t head_;
+    std::size_t tail_;
+};
+
+template <typename T, std::size_t MaxSize> using StackDeque = StaticDeque<T, MaxSize, StackStorage>;
+template <typename T, std::size_t MaxSize> using HeapDeque = StaticDeque<T, MaxSize, HeapStorage>;
+} // namespace containers
+
+#endif // CONTAINERS_STATIC_DEQUE_HPP
@@ -0,0 +1,477 @@
+#ifndef CONTAINERS_STATIC_HASH_MAP_HPP
+#define CONTAINERS_STATIC_HASH_MAP_HPP
+
+#include "heap_allocation_policy.hpp"
+#include "stack_allocation_policy.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Fixed-capacity hash map with open addressing and Robin Hood probing. Slots live in AllocationPolicy storage that
+// is reserved once at construction, so inserting and erasing never allocate.
+// Every slot stores its distance from the home slot of its key plus one (zero marks an empty slot). Insertion moves
+// elements that are closer to their home slot out of the way, which keeps probe sequences short even at high load,
+// and erasure shifts the following elements back, so there are no tombstones.
+// Insertion and erasure move elements between slots, which invalidates iterators and references.
+template <typename K, typename V, std::size_t Capacity, template <typename, std::size_t> class AllocationPolicy,
+          typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class StaticHashMap
+{
+    static_assert((Capacity > 0U), "StaticHashMap must have non-zero capacity.");
+
+    static constexpr std::size_t SLOT_COUNT = std::bit_ceil(Capacity);
+    static constexpr std::size_t LAST_INDEX = SLOT_COUNT - 1U;
+    static constexpr int HASH_SHIFT = 64 - std::countr_zero(SLOT_COUNT);
+
+    // Smallest type that can hold any probe distance
+    using Distance =
+        std::conditional_t<(SLOT_COUNT < 0xFFU), std::uint8_t,
+                           std::conditional_t<(SLOT_COUNT < 0xFFFFU), std::uint16_t, std::uint32_t>>;
+
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+
+    static constexpr auto MAX_SIZE = Capacity;
+
+    // Default constructor
+    StaticHashMap() : slots_{}, distances_{}, size_{0U}, max_distance_{0U}
+    {
+        for (std::size_t i = 0U; i < SLOT_COUNT; ++i)
+        {
+            distances_.allocate(i, Distance{0U});
+        }
+    }
+
+    // Destructor
+    ~StaticHashMap()
+    {
+        clear();
+    }
+
+    // Copy constructor
+    StaticHashMap(const StaticHashMap &other) : StaticHashMap{}
+    {
+        copyFrom(other);
+    }
+
+    // Copy assignment operator
+    StaticHashMap &operator=(const StaticHashMap &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copyFrom(other);
+        }
+
+        return *this;
+    }
+
+    // Iterators dereference to a pair of references into the slot, the key is read-only because changing it in place
+    // would break the probe order
+    template <bool IsConst> class basic_iterator final
+    {
+        using Map = std::conditional_t<IsConst, const StaticHashMap, StaticHashMap>;
+
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::pair<K, V>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const K &, std::conditional_t<IsConst, const V &, V &>>;
+
+        struct pointer
+        {
+            reference ref;
+
+            inline reference *operator->() noexcept
+            {
+                return &ref;
+            }
+        };
+
+        basic_iterator() noexcept = default;
+
+        basic_iterator(Map *map, const std::size_t index) noexcept : map_{map}, index_{index}
+        {
+            skipEmpty();
+        }
+
+        // Allow conversion from iterator to const_iterator
+        template <bool OtherConst>
+            requires(IsConst && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst> &other) noexcept : map_{other.map_}, index_{other.index_}
+        {
+        }
+
+        inline reference operator*() const noexcept
+        {
+            auto &slot = map_->slots_.getData(index_);
+            return reference{slot.first, slot.second};
+        }
+        inline pointer operator->() const noexcept
+        {
+            return pointer{**this};
+        }
+
+        inline basic_iterator &operator++() noexcept
+        {
+            ++index_;
+            skipEmpty();
+            return *this;
+        }
+        inline basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        inline friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ == b.index_);
+        }
+        inline friend bool operator!=(const basic_iterator &a, const basic_iterator &b) noexcept
+        {
+            return (a.index_ != b.index_);
+        }
+
+      private:
+        friend class StaticHashMap;
+        template <bool> friend class basic_iterator;
+
+        inline void skipEmpty() noexcept
+        {
+            while ((index_ < SLOT_COUNT) && (map_->distances_.getData(index_) == 0U))
+            {
+                ++index_;
+            }
+        }
+
+        Map *map_{nullptr};
+        std::size_t index_{SLOT_COUNT};
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    inline iterator begin() noexcept
+    {
+        return iterator{this, 0U};
+    }
+
+    inline iterator end() noexcept
+    {
+        return iterator{this, SLOT_COUNT};
+    }
+
+    inline const_iterator begin() const noexcept
+    {
+        return const_iterator{this, 0U};
+    }
+
+    inline const_iterator end() const noexcept
+    {
+        return const_iterator{this, SLOT_COUNT};
+    }
+
+    inline const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    inline const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    // Inserts the value if the key is not present. Returns the element with the key and whether it was inserted.
+    template <typename... Args> std::pair<iterator, bool> try_emplace(const K &key, Args &&...args)
+    {
+        const std::size_t index = findIndex(key);
+        if (index != SLOT_COUNT)
+        {
+            return {iterator{this, index}, false};
+        }
+
+        if (size_ >= MAX_SIZE)
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        return {iterator{this, insertNew(Slot{key, V{std::forward<Args>(args)...}})}, true};
+    }
+
+    inline std::pair<iterator, bool> insert(const value_type &value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    inline std::pair<iterator, bool> insert(value_type &&value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    template <typename U> std::pair<iterator, bool> insert_or_assign(const K &key, U &&value)
+    {
+        const std::size_t index = findIndex(key);
+        if (index != SLOT_COUNT)
+        {
+            slots_.getData(index).second = std::forward<U>(value);
+            return {iterator{this, index}, false};
+        }
+
+        return try_emplace(key, std::forward<U>(value));
+    }
+
+    // Returns the number of erased elements (0 or 1)
+    std::size_t erase(const K &key)
+    {
+        const std::size_t index = findIndex(key);
+        if (index == SLOT_COUNT)
+        {
+            return 0U;
+        }
+
+        eraseAt(index);
+        return 1U;
+    }
+
+    inline iterator find(const K &key) noexcept
+    {
+        return iterator{this, findIndex(key)};
+    }
+
+    inline const_iterator find(const K &key) const noexcept
+    {
+        return const_iterator{this, findIndex(key)};
+    }
+
+    inline bool contains(const K &key) const noexcept
+    {
+        return (findIndex(key) != SLOT_COUNT);
+    }
+
+    inline V &at(const K &key)
+    {
+        const std::size_t index = findIndex(key);
+        if (index == SLOT_COUNT)
+        {
+            throw std::out_of_range("Key not found.");
+        }
+
+        return slots_.getData(index).second;
+    }
+
+    inline const V &at(const K &key) const
+    {
+        const std::size_t index = findIndex(key);
+        if (index == SLOT_COUNT)
+        {
+            throw std::out_of_range("Key not found.");
+        }
+
+        return slots_.getData(index).second;
+    }
+
+    inline V &operator[](const K &key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    void clear() noexcept
+    {
+        for (std::size_t i = 0U; (i < SLOT_COUNT) && (size_ > 0U); ++i)
+        {
+            if (distances_.getData(i) != 0U)
+            {
+                slots_.deallocate(i);
+                distances_.getData(i) = 0U;
+                --size_;
+            }
+        }
+
+        max_distance_ = 0U;
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MAX_SIZE;
+    }
+
+    // Number of slots, the load factor at maxSize() is maxSize() / slotCount()
+    constexpr static inline std::size_t slotCount() noexcept
+    {
+        return SLOT_COUNT;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return (size_ == 0U);
+    }
+
+  private:
+    // The key is only moved by the map itself, while probing
+    using Slot = std::pair<K, V>;
+
+    // Exposes the protected interface of the allocation policy to the map
+    template <typename U> struct Storage : AllocationPolicy<U, SLOT_COUNT>
+    {
+        // Declared so that Storage is not an aggregate and the protected policy constructor is called from here
+        Storage() = default;
+
+        using AllocationPolicy<U, SLOT_COUNT>::allocate;
+        using AllocationPolicy<U, SLOT_COUNT>::deallocate;
+        using AllocationPolicy<U, SLOT_COUNT>::getData;
+    };
+
+    // Fibonacci hashing spreads poorly distributed hashes (e.g. the identity hash of integers) over the top bits
+    static inline std::size_t homeIndex(const K &key) noexcept
+    {
+        const std::uint64_t hash = static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        if constexpr (SLOT_COUNT == 1U)
+        {
+            return 0U;
+        }
+        else
+        {
+            return static_cast<std::size_t>(hash >> HASH_SHIFT);
+        }
+    }
+
+    // Returns SLOT_COUNT if the key is not present
+    std::size_t findIndex(const K &key) const noexcept
+    {
+        std::size_t index = homeIndex(key);
+
+        for (std::size_t distance = 1U; distance <= max_distance_; ++distance)
+        {
+            const std::size_t slot_distance = distances_.getData(index);
+
+            // Any element of this key would have displaced a slot closer to its home
+            if (slot_distance < distance)
+            {
+                break;
+            }
+
+            if ((slot_distance == distance) && KeyEqual{}(slots_.getData(index).first, key))
+            {
+                return index;
+            }
+
+            index = (index + 1U) & LAST_INDEX;
+        }
+
+        return SLOT_COUNT;
+    }
+
+    // Caller guarantees that the key is not present and the map is not full. Returns the final slot of the value.
+    std::size_t insertNew(Slot &&value)
+    {
+        std::size_t index = homeIndex(value.first);
+        std::size_t distance = 1U;
+        std::size_t inserted_index = SLOT_COUNT;
+
+        for (;;)
+        {
+            Distance &slot_distance = distances_.getData(index);
+
+            if (slot_distance == 0U)
+            {
+                slots_.allocate(index, std::move(value));
+                slot_distance = static_cast<Distance>(distance);
+                max_distance_ = std::max(max_distance_, distance);
+                ++size_;
+                return (inserted_index == SLOT_COUNT) ? index : inserted_index;
+            }
+
+            // Take the slot from an element that is closer to its home and carry that element forward instead
+            if (slot_distance < distance)
+            {
+                using std::swap;
+                swap(value, slots_.getData(index));
+
+                const std::size_t displaced_distance = slot_distance;
+                slot_distance = static_cast<Distance>(distance);
+                max_distance_ = std::max(max_distance_, distance);
+                distance = displaced_distance;
+
+                if (inserted_index == SLOT_COUNT)
+                {
+                    inserted_index = index;
+                }
+            }
+
+            index = (index + 1U) & LAST_INDEX;
+            ++distance;
+        }
+    }
+
+    void eraseAt(std::size_t index) noexcept
+    {
+        slots_.deallocate(index);
+
+        // Shift the following displaced elements back by one slot
+        std::size_t next = (index + 1U) & LAST_INDEX;
+        while (distances_.getData(next) > 1U)
+        {
+            slots_.allocate(index, std::move(slots_.getData(next)));
+            slots_.deallocate(next);
+            distances_.getData(index) = static_cast<Distance>(distances_.getData(next) - 1U);
+
+            index = next;
+            next = (next + 1U) & LAST_INDEX;
+        }
+
+        distances_.getData(index) = 0U;
+        --size_;
+    }
+
+    void copyFrom(const StaticHashMap &other)
+    {
+        for (std::size_t i = 0U; i < SLOT_COUNT; ++i)
+        {
+            if (other.distances_.getData(i) != 0U)
+            {
+                slots_.allocate(i, other.slots_.getData(i));
+                distances_.getData(i) = other.distances_.getData(i);
+                ++size_;
+            }
+        }
+
+        max_distance_ = other.max_distance_;
+    }
+
+    Storage<Slot> slots_;
+    Storage<Distance> distances_;
+    std::size_t size_;
+
+    // Longest probe sequence since the last clear(), bounds the search for missing keys
+    std::size_t max_distance_;
+};
+
+template <typename K, typename V, std::size_t Capacity, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+using StackHashMap = StaticHashMap<K, V, Capacity, StackAllocationPolicy, Hash, KeyEqual>;
+
+template <typename K, typename V, std::size_t Capacity, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+using HeapHashMap = StaticHashMap<K, V, Capacity, HeapAllocationPolicy, Hash, KeyEqual>;
+} // namespace containers
+
+#endif // CONTAINERS_STATIC_HASH_MAP_HPP
@@ -0,0 +1,528 @@
+#ifndef CONTAINERS_STATIC_PRIORITY_QUEUE_HPP
+#define CONTAINERS_STATIC_PRIORITY_QUEUE_HPP
+
+#include "generic_vector.hpp"
+#include "heap_allocation_policy.hpp"
+#include "stack_allocation_policy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+// Elements are stored as they are and cannot be addressed after push (the default)
+struct NoHandles
+{
+};
+
+// push() returns a Handle for decrease_key(), update() and erase(). Each element carries a slot index and the heap
+// position of every slot is kept in a second vector, one extra store per element move.
+struct TrackedHandles
+{
+};
+
+// Fixed-capacity priority queue on a GenericVector, laid out as an Arity-ary heap. The default 4-ary heap is half as
+// deep as a binary heap and the children of a node are adjacent, so a pop touches about half as many cache lines at
+// the cost of more comparisons per level. The children are compared as a tournament of conditional selects and pop()
+// sinks the hole to a leaf before placing the last element, which keeps random keys from costing a branch mispredict
+// per level. Like std::priority_queue, top() is an element that no other element compares greater than under Compare;
+// use std::greater<> for a min-heap.
+template <typename T, std::size_t MaxSize, typename Compare = std::less<>,
+          template <typename, std::size_t> class AllocationPolicy = HeapAllocationPolicy, std::size_t Arity = 4U,
+          typename HandlePolicy = NoHandles>
+class StaticPriorityQueue
+{
+    static_assert((MaxSize > 0U), "StaticPriorityQueue must have non-zero size.");
+    static_assert((Arity >= 2U), "StaticPriorityQueue's Arity must be at least 2.");
+    static_assert(std::is_same_v<HandlePolicy, NoHandles> || std::is_same_v<HandlePolicy, TrackedHandles>,
+                  "HandlePolicy must be either NoHandles or TrackedHandles");
+
+    static constexpr bool TRACKED = std::is_same_v<HandlePolicy, TrackedHandles>;
+
+    // 32-bit slots keep the entries of small element types at 8 bytes
+    using Index =
+        std::conditional_t<(MaxSize < std::numeric_limits<std::uint32_t>::max()), std::uint32_t, std::size_t>;
+
+    static constexpr Index NO_SLOT = std::numeric_limits<Index>::max();
+
+    struct TrackedEntry
+    {
+        T value;
+        Index slot;
+    };
+
+    using Entry = std::conditional_t<TRACKED, TrackedEntry, T>;
+
+    // Heap position of every slot in use, next free slot of every freed one
+    struct SlotTable
+    {
+        SlotTable() = default;
+        SlotTable(const SlotTable &) = default;
+        SlotTable &operator=(const SlotTable &) = default;
+
+        SlotTable(SlotTable &&other) noexcept
+            : positions{std::move(other.positions)}, free_head{std::exchange(other.free_head, NO_SLOT)}
+        {
+        }
+
+        SlotTable &operator=(SlotTable &&other) noexcept
+        {
+            positions = std::move(other.positions);
+            free_head = std::exchange(other.free_head, NO_SLOT);
+            return *this;
+        }
+
+        GenericVector<Index, MaxSize, AllocationPolicy> positions;
+        Index free_head{NO_SLOT};
+    };
+
+    struct NoSlotTable
+    {
+    };
+
+  public:
+    using value_type = T;
+    using value_compare = Compare;
+
+    static constexpr auto MAX_SIZE = MaxSize;
+    static constexpr auto ARITY = Arity;
+
+    // Valid until its element is popped or erased
+    class Handle
+    {
+      public:
+        Handle() noexcept = default;
+
+        bool operator==(const Handle &) const noexcept = default;
+
+      private:
+        friend class StaticPriorityQueue;
+
+        explicit Handle(const Index slot) noexcept : slot_{slot}
+        {
+        }
+
+        Index slot_{NO_SLOT};
+    };
+
+    // Default constructor
+    StaticPriorityQueue() = default;
+
+    explicit StaticPriorityQueue(const Compare &compare) : compare_{compare}
+    {
+    }
+
+    // Returns a Handle with TrackedHandles, nothing otherwise
+    template <typename U> inline auto push(U &&value)
+    {
+        return emplace(std::forward<U>(value));
+    }
+
+    template <typename... Args> void emplace(Args &&...args)
+        requires(!TRACKED)
+    {
+        siftUp(append(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args> Handle emplace(Args &&...args)
+        requires TRACKED
+    {
+        const std::size_t position = append(std::forward<Args>(args)...);
+        const Index slot = heap_[position].slot;
+        siftUp(position);
+        return Handle{slot};
+    }
+
+    // Pushes a range at once. When the range is at least as large as the queue, the whole heap is rebuilt bottom-up
+    // (Floyd), which is O(n) instead of O(n log n) for n single pushes. Throws without modifying the queue if the range
+    // does not fit. No handles are returned, push elements one by one where handles are needed.
+    template <typename InputIt> void push_range(InputIt first, InputIt last)
+    {
+        const std::size_t old_size = size();
+
+        try
+        {
+            for (; first != last; ++first)
+            {
+                append(*first);
+            }
+        }
+        catch (...)
+        {
+            while (size() > old_size)
+            {
+                if constexpr (TRACKED)
+                {
+                    releaseSlot(heap_.back().slot);
+                }
+                heap_.pop_back();
+            }
+            throw;
+        }
+
+        if ((size() - old_size) >= old_size)
+        {
+            heapify();
+        }
+        else
+        {
+            for (std::size_t position = old_size; position < size(); ++position)
+            {
+                siftUp(position);
+            }
+        }
+    }
+
+    inline const T &top() const
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        return valueOf(heap_[0U]);
+    }
+
+    // Removes and returns the top element
+    T pop()
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Empty container.");
+        }
+
+        T value = std::move(valueOf(heap_[0U]));
+        if constexpr (TRACKED)
+        {
+            releaseSlot(heap_[0U].slot);
+        }
+        removeTop();
+        return value;
+    }
+
+    inline const T &get(const Handle handle) const noexcept
+        requires TRACKED
+    {
+        return heap_[slots_.positions[handle.slot_]].value;
+    }
+
+    // Raises the priority of an element, i.e. lowers its key in a min-heap. Throws if the new value compares lower than
+    // the current one, use update() to move an element either way.
+    template <typename U> void decrease_key(const Handle handle, U &&value)
+        requires TRACKED
+    {
+        const std::size_t position = slots_.positions[handle.slot_];
+        if (compare_(value, heap_[position].value))
+        {
+            throw std::runtime_error("decrease_key would lower the priority.");
+        }
+
+        heap_[position].value = std::forward<U>(value);
+        siftUp(position);
+    }
+
+    // Replaces the value of an element and restores the heap in whichever direction it moved
+    template <typename U> void update(const Handle handle, U &&value)
+        requires TRACKED
+    {
+        const std::size_t position = slots_.positions[handle.slot_];
+        heap_[position].value = std::forward<U>(value);
+        restore(position);
+    }
+
+    void erase(const Handle handle)
+        requires TRACKED
+    {
+        const std::size_t position = slots_.positions[handle.slot_];
+        releaseSlot(handle.slot_);
+
+        // Fill the hole with the last element and move that to its place
+        const std::size_t last = heap_.size() - 1U;
+        if (position != last)
+        {
+            heap_[position] = std::move(heap_[last]);
+            heap_.pop_back();
+            restore(position);
+        }
+        else
+        {
+            heap_.pop_back();
+        }
+    }
+
+    inline void clear() noexcept
+    {
+        heap_.clear();
+        if constexpr (TRACKED)
+        {
+            slots_.positions.clear();
+            slots_.free_head = NO_SLOT;
+        }
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return heap_.size();
+    }
+
+    constexpr static inline std::size_t maxSize() noexcept
+    {
+        return MaxSize;
+    }
+
+    inline bool empty() const noexcept
+    {
+        return heap_.empty();
+    }
+
+    inline bool full() const noexcept
+    {
+        return (heap_.size() == MaxSize);
+    }
+
+  private:
+    static inline T &valueOf(Entry &entry) noexcept
+    {
+        if constexpr (TRACKED)
+        {
+            return entry.value;
+        }
+        else
+        {
+            return entry;
+        }
+    }
+
+    static inline const T &valueOf(const Entry &entry) noexcept
+    {
+        if constexpr (TRACKED)
+        {
+            return entry.value;
+        }
+        else
+        {
+            return entry;
+        }
+    }
+
+    inline bool lower(const std::size_t lhs, const std::size_t rhs) const
+    {
+        return compare_(valueOf(heap_[lhs]), valueOf(heap_[rhs]));
+    }
+
+    inline Index acquireSlot()
+    {
+        if (slots_.free_head != NO_SLOT)
+        {
+            const Index slot = slots_.free_head;
+            slots_.free_head = slots_.positions[slot];
+            return slot;
+        }
+
+        slots_.positions.push_back(NO_SLOT);
+        return static_cast<Index>(slots_.positions.size() - 1U);
+    }
+
+    inline void releaseSlot(const Index slot) noexcept
+    {
+        slots_.positions[slot] = slots_.free_head;
+        slots_.free_head = slot;
+    }
+
+    // Appends an element at the bottom without restoring the heap, returns its position
+    template <typename... Args> std::size_t append(Args &&...args)
+    {
+        if (full())
+        {
+            throw std::runtime_error("Capacity exceeded.");
+        }
+
+        const std::size_t position = heap_.size();
+        if constexpr (TRACKED)
+        {
+            const Index slot = acquireSlot();
+            try
+            {
+                heap_.emplace_back(T{std::forward<Args>(args)...}, slot);
+            }
+            catch (...)
+            {
+                releaseSlot(slot);
+                throw;
+            }
+            slots_.positions[slot] = static_cast<Index>(position);
+        }
+        else
+        {
+            heap_.emplace_back(std::forward<Args>(args)...);
+        }
+
+        return position;
+    }
+
+    inline void place(const std::size_t position, Entry &&entry)
+    {
+        if constexpr (TRACKED)
+        {
+            slots_.positions[entry.slot] = static_cast<Index>(position);
+        }
+        heap_[position] = std::move(entry);
+    }
+
+    // Highest-priority child among those starting at first_child and ending before count. A full set of children is
+    // reduced pairwise, so the selects of one round are independent of each other.
+    inline std::size_t bestChild(const std::size_t first_child, const std::size_t count) const
+    {
+        if ((first_child + Arity) <= count)
+        {
+            std::size_t winners[Arity];
+            for (std::size_t k = 0U; k < Arity; ++k)
+            {
+                winners[k] = first_child + k;
+            }
+
+            for (std::size_t width = Arity; width > 1U; width = (width + 1U) / 2U)
+            {
+                for (std::size_t k = 0U; k < (width / 2U); ++k)
+                {
+                    const std::size_t lhs = winners[2U * k];
+                    const std::size_t rhs = winners[(2U * k) + 1U];
+                    winners[k] = lower(lhs, rhs) ? rhs : lhs;
+                }
+                if ((width % 2U) == 1U)
+                {
+                    winners[width / 2U] = winners[width - 1U];
+                }
+            }
+
+            return winners[0U];
+        }
+
+        std::size_t best = first_child;
+        for (std::size_t child = first_child + 1U; child < count; ++child)
+        {
+            if (lower(best, child))
+            {
+                best = child;
+            }
+        }
+        return best;
+    }
+
+    // Moves a hole up instead of swapping, so every level costs one element move
+    void siftUp(std::size_t position)
+    {
+        Entry entry = std::move(heap_[position]);
+        while (position > 0U)
+        {
+            const std::size_t parent = (position - 1U) / Arity;
+            if (!compare_(valueOf(heap_[parent]), valueOf(entry)))
+            {
+                break;
+            }
+
+            place(position, std::move(heap_[parent]));
+            position = parent;
+        }
+        place(position, std::move(entry));
+    }
+
+    void siftDown(std::size_t position)
+    {
+        const std::size_t count = heap_.size();
+        Entry entry = std::move(heap_[position]);
+        while (true)
+        {
+            const std::size_t first_child = (position * Arity) + 1U;
+            if (first_child >= count)
+            {
+                break;
+            }
+
+            const std::size_t best = bestChild(first_child, count);
+            if (!compare_(valueOf(entry), valueOf(heap_[best])))
+            {
+                break;
+            }
+
+            place(position, std::move(heap_[best]));
+            position = best;
+        }
+        place(position, std::move(entry));
+    }
+
+    inline void restore(const std::size_t position)
+    {
+        if ((position > 0U) && lower((position - 1U) / Arity, position))
+        {
+            siftUp(position);
+        }
+        else
+        {
+            siftDown(position);
+        }
+    }
+
+    // Floyd's bottom-up construction, sifting down every parent from the last one
+    void heapify()
+    {
+        if (size() < 2U)
+        {
+            return;
+        }
+
+        for (std::size_t parent = ((size() - 2U) / Arity) + 1U; parent > 0U; --parent)
+        {
+            siftDown(parent - 1U);
+        }
+    }
+
+    // The last element almost always belongs near the bottom, so the hole at the root is first moved down to a leaf
+    // without comparing against it, then the last element is placed there and sifted up the few levels it needs
+    void removeTop()
+    {
+        const std::size_t last = heap_.size() - 1U;
+        std::size_t position = 0U;
+        while (true)
+        {
+            const std::size_t first_child = (position * Arity) + 1U;
+            if (first_child >= last)
+            {
+                break;
+            }
+
+            const std::size_t best = bestChild(first_child, last);
+            place(position, std::move(heap_[best]));
+            position = best;
+        }
+
+        if (position != last)
+        {
+            place(position, std::move(heap_[last]));
+            heap_.pop_back();
+            siftUp(position);
+        }
+        else
+        {
+            heap_.pop_back();
+        }
+    }
+
+    GenericVector<Entry, MaxSize, AllocationPolicy> heap_;
+    [[no_unique_address]] std::conditional_t<TRACKED, SlotTable, NoSlotTable> slots_;
+    [[no_unique_address]] Compare compare_{};
+};
+
+template <typename T, std::size_t MaxSize, typename Compare = std::less<>>
+using StackPriorityQueue = StaticPriorityQueue<T, MaxSize, Compare, StackAllocationPolicy>;
+template <typename T, std::size_t MaxSize, typename Compare = std::less<>>
+using HeapPriorityQueue = StaticPriorityQueue<T, MaxSize, Compare, HeapAllocationPolicy>;
+} // namespace containers
+
+#endif // CONTAINERS_STATIC_PRIORITY_QUEUE_HPP
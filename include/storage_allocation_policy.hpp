@@ -0,0 +1,58 @@
+#ifndef CONTAINERS_STORAGE_ALLOCATION_POLICY_HPP
+#define CONTAINERS_STORAGE_ALLOCATION_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace containers
+{
+// Allocation policy for GenericVector and the containers built on it that takes its memory from a storage policy
+// (anything with a buffer() returning room for MaxSize elements), e.g.
+//
+//     template <typename T, std::size_t MaxSize>
+//     using HugePageAllocationPolicy = StorageAllocationPolicy<T, MaxSize, HugePageStorage>;
+template <typename T, std::size_t MaxSize, template <typename, std::size_t> class StoragePolicy>
+class StorageAllocationPolicy
+{
+  protected:
+    StorageAllocationPolicy() = default;
+    ~StorageAllocationPolicy() = default;
+
+    template <typename... Args> inline void allocate(const std::size_t index, Args &&...args)
+    {
+        new (&getData(index)) T{std::forward<Args>(args)...};
+    }
+
+    inline void deallocate(const std::size_t index)
+    {
+        getData(index).~T();
+    }
+
+    inline T &getData(const std::size_t index) noexcept
+    {
+        return storage_.buffer()[index];
+    }
+
+    inline const T &getData(const std::size_t index) const noexcept
+    {
+        return storage_.buffer()[index];
+    }
+
+    inline StoragePolicy<T, MaxSize> &storage() noexcept
+    {
+        return storage_;
+    }
+
+    inline const StoragePolicy<T, MaxSize> &storage() const noexcept
+    {
+        return storage_;
+    }
+
+  private:
+    StoragePolicy<T, MaxSize> storage_;
+};
+} // namespace containers
+
+#endif // CONTAINERS_STORAGE_ALLOCATION_POLICY_HPP
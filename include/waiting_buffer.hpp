@@ -0,0 +1,436 @@
+#ifndef CONTAINERS_WAITING_BUFFER_HPP
+#define CONTAINERS_WAITING_BUFFER_HPP
+
+#include "cache_line.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace containers
+{
+// Wait strategies decide what a consumer of an empty buffer does until an element arrives or a deadline passes. Each
+// one provides
+//
+//     template <typename Ready> bool waitUntil(Ready &&ready, std::chrono::steady_clock::time_point deadline);
+//     void notifyOne() noexcept;
+//     void notifyAll() noexcept;
+//
+// waitUntil() retries ready() until it returns true, or returns false once the deadline has passed. The notify
+// functions are called by producers after an element has been published.
+
+namespace detail
+{
+// Hint to the CPU that this is a spin loop: saves power and avoids the memory order violation when the loop exits
+inline void cpuRelax() noexcept
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    _mm_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// Reading the clock costs tens of cycles, spin loops only check the deadline once per this many iterations
+inline constexpr std::uint32_t DEADLINE_CHECK_INTERVAL = 64U;
+
+inline bool unbounded(const std::chrono::steady_clock::time_point deadline) noexcept
+{
+    return (deadline == std::chrono::steady_clock::time_point::max());
+}
+
+// Spins with cpuRelax() for up to spins attempts, returns true as soon as ready() does
+template <typename Ready>
+inline bool spin(Ready &ready, const std::uint32_t spins, const std::chrono::steady_clock::time_point deadline)
+{
+    for (std::uint32_t i = 0U; i < spins; ++i)
+    {
+        if (ready())
+        {
+            return true;
+        }
+        cpuRelax();
+
+        if ((((i + 1U) % DEADLINE_CHECK_INTERVAL) == 0U) && !unbounded(deadline) &&
+            (std::chrono::steady_clock::now() >= deadline))
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+} // namespace detail
+
+// Lowest latency, burns a core for as long as the consumer waits. Only suited to a consumer pinned to its own core.
+class BusySpinWait
+{
+  public:
+    template <typename Ready> bool waitUntil(Ready &&ready, const std::chrono::steady_clock::time_point deadline)
+    {
+        while (true)
+        {
+            if (detail::spin(ready, detail::DEADLINE_CHECK_INTERVAL, deadline))
+            {
+                return true;
+            }
+            if (!detail::unbounded(deadline) && (std::chrono::steady_clock::now() >= deadline))
+            {
+                return ready();
+            }
+        }
+    }
+
+    inline void notifyOne() noexcept
+    {
+    }
+
+    inline void notifyAll() noexcept
+    {
+    }
+};
+
+// Spins SpinCount times, then yields the core between attempts. Never sleeps in the kernel, so a waiting consumer
+// still shows as busy but lets other threads on its core run.
+template <std::uint32_t SpinCount = 256U> class SpinYieldWait
+{
+  public:
+    template <typename Ready> bool waitUntil(Ready &&ready, const std::chrono::steady_clock::time_point deadline)
+    {
+        if (detail::spin(ready, SpinCount, deadline))
+        {
+            return true;
+        }
+
+        while (true)
+        {
+            if (ready())
+            {
+                return true;
+            }
+            if (!detail::unbounded(deadline) && (std::chrono::steady_clock::now() >= deadline))
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    inline void notifyOne() noexcept
+    {
+    }
+
+    inline void notifyAll() noexcept
+    {
+    }
+};
+
+// Spins SpinCount times, then parks the consumer in the kernel until a producer wakes it. Producers pay a fence and a
+// load per notification and only issue the wake-up syscall while a consumer is actually parked.
+//
+// Parking is a futex wait on a 32-bit epoch that producers bump before waking. C++20 std::atomic::wait has no timed
+// form, so on Linux the futex syscall is issued directly, which supports the deadline of pop_for(); elsewhere
+// std::atomic::wait/notify is used and timed waits fall back to yielding until the deadline.
+template <std::uint32_t SpinCount = 256U> class ParkingWait
+{
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free &&
+                      (sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t)),
+                  "ParkingWait requires a 32-bit lock-free atomic to use as the futex word.");
+
+  public:
+    template <typename Ready> bool waitUntil(Ready &&ready, const std::chrono::steady_clock::time_point deadline)
+    {
+        if (detail::spin(ready, SpinCount, deadline))
+        {
+            return true;
+        }
+
+        while (true)
+        {
+            // Announce the waiter before the last check, producers either see it or their element is seen here
+            state_.waiters.fetch_add(1U, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::uint32_t epoch = state_.epoch.load(std::memory_order_acquire);
+
+            const bool success = ready();
+            const bool expired = !success && !detail::unbounded(deadline) &&
+                                 (std::chrono::steady_clock::now() >= deadline);
+            if (!success && !expired)
+            {
+                park(epoch, deadline);
+            }
+            state_.waiters.fetch_sub(1U, std::memory_order_relaxed);
+
+            if (success || ready())
+            {
+                return true;
+            }
+            if (expired)
+            {
+                return false;
+            }
+        }
+    }
+
+    inline void notifyOne() noexcept
+    {
+        if (hasWaiters())
+        {
+            state_.epoch.fetch_add(1U, std::memory_order_release);
+            wake(1);
+        }
+    }
+
+    inline void notifyAll() noexcept
+    {
+        if (hasWaiters())
+        {
+            state_.epoch.fetch_add(1U, std::memory_order_release);
+            wake(INT_MAX);
+        }
+    }
+
+  private:
+    // Pairs with the fence in waitUntil(), so a waiter that missed the element is always seen here
+    inline bool hasWaiters() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return (state_.waiters.load(std::memory_order_relaxed) != 0U);
+    }
+
+    // Returns on a wake-up, a timeout, a signal or when the epoch no longer matches; the caller retries in all cases
+    inline void park(const std::uint32_t epoch, const std::chrono::steady_clock::time_point deadline) noexcept
+    {
+#if defined(__linux__)
+        timespec timeout{};
+        if (!detail::unbounded(deadline))
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0)
+            {
+                return;
+            }
+            timeout.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+            timeout.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+        }
+        ::syscall(SYS_futex, futexWord(), FUTEX_WAIT_PRIVATE, epoch,
+                  detail::unbounded(deadline) ? nullptr : &timeout, nullptr, 0);
+#else
+        if (detail::unbounded(deadline))
+        {
+            state_.epoch.wait(epoch, std::memory_order_acquire);
+        }
+        else if (state_.epoch.load(std::memory_order_acquire) == epoch)
+        {
+            std::this_thread::yield();
+        }
+#endif
+    }
+
+    inline void wake([[maybe_unused]] const int count) noexcept
+    {
+#if defined(__linux__)
+        ::syscall(SYS_futex, futexWord(), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+        if (count == 1)
+        {
+            state_.epoch.notify_one();
+        }
+        else
+        {
+            state_.epoch.notify_all();
+        }
+#endif
+    }
+
+#if defined(__linux__)
+    inline std::uint32_t *futexWord() noexcept
+    {
+        return reinterpret_cast<std::uint32_t *>(&state_.epoch);
+    }
+#endif
+
+    // Shared by producers and consumers, kept apart from the indices of the buffer
+    struct alignas(CACHE_LINE_SIZE) State
+    {
+        std::atomic<std::uint32_t> epoch{0U};
+        std::atomic<std::uint32_t> waiters{0U};
+    };
+
+    State state_;
+};
+
+// Blocking and timed pops on top of a lock-free buffer with try_push()/try_pop(), such as SpscCircularBuffer or
+// MpmcCircularBuffer. The WaitStrategy trades consumer CPU time for wake-up latency without changing the buffer: see
+// BusySpinWait, SpinYieldWait and ParkingWait. The threading rules of Buffer still apply, e.g. a single producer and a
+// single consumer for SpscCircularBuffer.
+template <typename Buffer, typename WaitStrategy = SpinYieldWait<>> class WaitingBuffer
+{
+  public:
+    using value_type = typename Buffer::value_type;
+
+    // Arguments are forwarded to the constructor of the buffer
+    template <typename... Args>
+    explicit WaitingBuffer(Args &&...args) noexcept(std::is_nothrow_constructible_v<Buffer, Args...>)
+        : buffer_{std::forward<Args>(args)...}
+    {
+    }
+
+    WaitingBuffer(const WaitingBuffer &) = delete;
+    WaitingBuffer &operator=(const WaitingBuffer &) = delete;
+    WaitingBuffer(WaitingBuffer &&) = delete;
+    WaitingBuffer &operator=(WaitingBuffer &&) = delete;
+
+    // Pushes and wakes a waiting consumer
+    template <typename U> bool try_push(U &&value)
+    {
+        if (!buffer_.try_push(std::forward<U>(value)))
+        {
+            return false;
+        }
+
+        strategy_.notifyOne();
+        return true;
+    }
+
+    // Pushes as many elements as fit and wakes the consumers once for the whole batch, returns the number pushed
+    std::size_t try_push_n(const value_type *values, const std::size_t count)
+    {
+        std::size_t pushed = 0U;
+        while ((pushed < count) && buffer_.try_push(values[pushed]))
+        {
+            ++pushed;
+        }
+
+        if (pushed > 1U)
+        {
+            strategy_.notifyAll();
+        }
+        else if (pushed == 1U)
+        {
+            strategy_.notifyOne();
+        }
+        return pushed;
+    }
+
+    // Pushes without waking anyone, for producers that batch their own wake-ups with notify()
+    template <typename U> bool try_push_quiet(U &&value)
+    {
+        return buffer_.try_push(std::forward<U>(value));
+    }
+
+    inline void notify() noexcept
+    {
+        strategy_.notifyAll();
+    }
+
+    bool try_pop(value_type &out_value) noexcept(noexcept(std::declval<Buffer &>().try_pop(out_value)))
+    {
+        return buffer_.try_pop(out_value);
+    }
+
+    // Waits as long as it takes for an element
+    value_type pop()
+    {
+        value_type value{};
+        strategy_.waitUntil([&]() { return buffer_.try_pop(value); }, std::chrono::steady_clock::time_point::max());
+        return value;
+    }
+
+    // Returns false if no element arrived within the timeout
+    template <typename Rep, typename Period>
+    bool pop_for(value_type &out_value, const std::chrono::duration<Rep, Period> &timeout)
+    {
+        return pop_until(out_value, deadlineAfter(timeout));
+    }
+
+    bool pop_until(value_type &out_value, const std::chrono::steady_clock::time_point deadline)
+    {
+        return strategy_.waitUntil([&]() { return buffer_.try_pop(out_value); }, deadline);
+    }
+
+    // Waits for the first element like pop_for(), then takes whatever else is already there, up to count elements.
+    // Returns the number of elements popped, 0 on timeout.
+    template <typename Rep, typename Period>
+    std::size_t pop_n_for(value_type *out_values, const std::size_t count,
+                          const std::chrono::duration<Rep, Period> &timeout)
+    {
+        if ((count == 0U) || !pop_until(out_values[0], deadlineAfter(timeout)))
+        {
+            return 0U;
+        }
+
+        std::size_t popped = 1U;
+        while ((popped < count) && buffer_.try_pop(out_values[popped]))
+        {
+            ++popped;
+        }
+        return popped;
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return buffer_.size();
+    }
+
+    inline bool empty() const noexcept
+    {
+        return buffer_.empty();
+    }
+
+    inline bool full() const noexcept
+    {
+        return buffer_.full();
+    }
+
+  private:
+    // Saturates instead of overflowing for very long timeouts. The limits are checked in the clock's own duration, the
+    // timeout is only converted once it is known to fit.
+    template <typename Rep, typename Period>
+    static inline std::chrono::steady_clock::time_point deadlineAfter(const std::chrono::duration<Rep, Period> &timeout)
+    {
+        using Duration = std::chrono::steady_clock::duration;
+        using Ticks = std::chrono::duration<double, Duration::period>;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (timeout <= timeout.zero())
+        {
+            return now;
+        }
+        if (Ticks{timeout} >= Ticks{Duration::max()})
+        {
+            return std::chrono::steady_clock::time_point::max();
+        }
+
+        const Duration converted = std::chrono::ceil<Duration>(timeout);
+        if (converted >= (std::chrono::steady_clock::time_point::max() - now))
+        {
+            return std::chrono::steady_clock::time_point::max();
+        }
+
+        return now + converted;
+    }
+
+    Buffer buffer_;
+    WaitStrategy strategy_;
+};
+} // namespace containers
+
+#endif // CONTAINERS_WAITING_BUFFER_HPP